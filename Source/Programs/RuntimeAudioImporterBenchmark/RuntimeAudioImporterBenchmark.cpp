@@ -0,0 +1,615 @@
+// Georgy Treshchev 2022.
+
+/**
+ * Standalone microbenchmark of the transcoding kernels and the third-party decoders and encoders, built without the engine
+ *
+ * Usage: RuntimeAudioImporterBenchmark [--duration <seconds>] [--channels <count>] [--time <seconds>] [--file <path>]...
+ *   --duration  Duration of the generated signal, in seconds (default 30)
+ *   --channels  Number of channels of the generated signal (default 2)
+ *   --time      Minimum measuring time per benchmark, in seconds (default 0.5)
+ *   --file      Additional audio file to measure the decoding of, by extension (mp3, wav, flac, ogg). Can be repeated
+ *
+ * Ogg Vorbis is encoded and decoded from the generated signal only when built with libvorbis (see CMakeLists.txt), otherwise pass an .ogg file with --file
+ */
+
+#include "CoreMinimal.h"
+#include "Transcoders/RAWTranscoder.h"
+#include "Tests/RuntimeAudioImporterFixtures.h"
+
+#define DR_WAV_IMPLEMENTATION
+#define DR_MP3_IMPLEMENTATION
+#define DR_FLAC_IMPLEMENTATION
+#include "ThirdParty/dr_wav.h"
+#include "ThirdParty/dr_mp3.h"
+#include "ThirdParty/dr_flac.h"
+#include "ThirdParty/stb_vorbis.c"
+
+#if RUNTIMEAUDIOIMPORTER_BENCHMARK_WITH_VORBIS
+#include "vorbis/vorbisenc.h"
+#endif
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+
+namespace
+{
+	/** Sample rate of the generated signal */
+	constexpr uint32 SampleRate = 44100;
+
+	/** Minimum measuring time per benchmark, in seconds */
+	double MinMeasuringTime = 0.5;
+
+	/** Sink for the benchmark results, so that the compiler does not remove the measured work */
+	volatile float ResultSink = 0.f;
+
+	/**
+	 * Run the function repeatedly for at least the minimum measuring time
+	 *
+	 * @return Average time of a single run, in seconds
+	 */
+	double Measure(const std::function<void()>& Function)
+	{
+		using FClock = std::chrono::steady_clock;
+
+		// Warming up the caches and the allocator
+		Function();
+
+		uint64 NumOfRuns = 0;
+		const FClock::time_point StartTime = FClock::now();
+		double ElapsedTime = 0.;
+
+		do
+		{
+			Function();
+			++NumOfRuns;
+			ElapsedTime = std::chrono::duration<double>(FClock::now() - StartTime).count();
+		}
+		while (ElapsedTime < MinMeasuringTime);
+
+		return ElapsedTime / NumOfRuns;
+	}
+
+	/**
+	 * Print the result of a kernel benchmark
+	 *
+	 * @param Name Name of the benchmark
+	 * @param Time Average time of a single run, in seconds
+	 * @param NumOfSamples Number of samples processed by a single run
+	 * @param NumOfBytes Number of bytes read and written by a single run
+	 */
+	void ReportKernel(const std::string& Name, double Time, uint64 NumOfSamples, uint64 NumOfBytes)
+	{
+		std::printf("%-40s %10.3f ns/sample %10.2f GB/s\n", Name.c_str(), Time * 1e9 / NumOfSamples, NumOfBytes / Time / 1e9);
+	}
+
+	/**
+	 * Print the result of a decoder or encoder benchmark
+	 *
+	 * @param Name Name of the benchmark
+	 * @param Time Average time of a single run, in seconds
+	 * @param NumOfFrames Number of frames processed by a single run
+	 * @param NumOfChannels Number of channels of the frames
+	 */
+	void ReportCodec(const std::string& Name, double Time, uint64 NumOfFrames, uint32 NumOfChannels)
+	{
+		std::printf("%-40s %10.3f ns/sample %10.2f Mframes/s %10.1fx realtime\n", Name.c_str(), Time * 1e9 / (NumOfFrames * NumOfChannels), NumOfFrames / Time / 1e6, NumOfFrames / static_cast<double>(SampleRate) / Time);
+	}
+
+	/**
+	 * Generate interleaved 32-bit float PCM data of the test signal shared with the automation tests
+	 */
+	std::vector<float> GenerateSignal(uint32 NumOfChannels, uint32 NumOfFrames)
+	{
+		std::vector<float> Signal(static_cast<size_t>(NumOfFrames) * NumOfChannels);
+
+		for (uint32 FrameIndex = 0; FrameIndex < NumOfFrames; ++FrameIndex)
+		{
+			for (uint32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+			{
+				Signal[static_cast<size_t>(FrameIndex) * NumOfChannels + ChannelIndex] = RuntimeAudioImporter_Fixtures::GetSignalSample(ChannelIndex, FrameIndex, SampleRate);
+			}
+		}
+
+		return Signal;
+	}
+
+	/**
+	 * Convert the float signal to the specified RAW format with the transcoding kernel
+	 */
+	template <typename IntegralType>
+	std::vector<IntegralType> ConvertSignal(const std::vector<float>& Signal)
+	{
+		IntegralType* Data = nullptr;
+		int32 DataSize = 0;
+		RAWTranscoder::TranscodeRAWData<float, IntegralType>(const_cast<float*>(Signal.data()), static_cast<int32>(Signal.size() * sizeof(float)), Data, DataSize);
+
+		std::vector<IntegralType> Converted(Data, Data + DataSize / sizeof(IntegralType));
+		FMemory::Free(Data);
+
+		return Converted;
+	}
+
+	template <typename IntegralType>
+	const char* GetRAWFormatName();
+
+	template <>
+	const char* GetRAWFormatName<int16>()
+	{
+		return "int16";
+	}
+
+	template <>
+	const char* GetRAWFormatName<int32>()
+	{
+		return "int32";
+	}
+
+	template <>
+	const char* GetRAWFormatName<uint8>()
+	{
+		return "uint8";
+	}
+
+	template <>
+	const char* GetRAWFormatName<float>()
+	{
+		return "float";
+	}
+
+	/**
+	 * Benchmark RAWTranscoder::TranscodeRAWData for a single type pair
+	 */
+	template <typename IntegralTypeFrom, typename IntegralTypeTo>
+	void BenchmarkTranscodeRAW(const std::vector<float>& Signal)
+	{
+		const std::vector<IntegralTypeFrom> Input = ConvertSignal<IntegralTypeFrom>(Signal);
+
+		const double Time = Measure([&Input]()
+		{
+			IntegralTypeTo* Output = nullptr;
+			int32 OutputSize = 0;
+
+			RAWTranscoder::TranscodeRAWData<IntegralTypeFrom, IntegralTypeTo>(const_cast<IntegralTypeFrom*>(Input.data()), static_cast<int32>(Input.size() * sizeof(IntegralTypeFrom)), Output, OutputSize);
+
+			ResultSink = ResultSink + static_cast<float>(Output[0]);
+			FMemory::Free(Output);
+		});
+
+		ReportKernel(std::string("TranscodeRAWData ") + GetRAWFormatName<IntegralTypeFrom>() + " -> " + GetRAWFormatName<IntegralTypeTo>(), Time, Input.size(), Input.size() * (sizeof(IntegralTypeFrom) + sizeof(IntegralTypeTo)));
+	}
+
+	/**
+	 * Benchmark RAWTranscoder::TranscodeRAWData from the specified type to every type
+	 */
+	template <typename IntegralTypeFrom>
+	void BenchmarkTranscodeRAWFrom(const std::vector<float>& Signal)
+	{
+		BenchmarkTranscodeRAW<IntegralTypeFrom, int16>(Signal);
+		BenchmarkTranscodeRAW<IntegralTypeFrom, int32>(Signal);
+		BenchmarkTranscodeRAW<IntegralTypeFrom, uint8>(Signal);
+		BenchmarkTranscodeRAW<IntegralTypeFrom, float>(Signal);
+	}
+
+	/**
+	 * Benchmark deinterleaving into per-channel buffers, the same way the Vorbis encoder feeds its analysis buffer
+	 */
+	void BenchmarkDeinterleave(const std::vector<float>& Signal, uint32 NumOfChannels)
+	{
+		const uint32 NumOfFrames = static_cast<uint32>(Signal.size() / NumOfChannels);
+		std::vector<std::vector<float>> Channels(NumOfChannels, std::vector<float>(NumOfFrames));
+
+		const double Time = Measure([&]()
+		{
+			for (uint32 FrameIndex = 0; FrameIndex < NumOfFrames; ++FrameIndex)
+			{
+				const float* Frame = Signal.data() + static_cast<size_t>(FrameIndex) * NumOfChannels;
+
+				for (uint32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+				{
+					Channels[ChannelIndex][FrameIndex] = Frame[ChannelIndex];
+				}
+			}
+
+			ResultSink = ResultSink + Channels[0][NumOfFrames / 2];
+		});
+
+		ReportKernel("Deinterleave " + std::to_string(NumOfChannels) + " channel(s)", Time, Signal.size(), Signal.size() * sizeof(float) * 2);
+	}
+
+	/**
+	 * Generate 16-bit FLAC audio data made of verbatim subframes
+	 */
+	std::vector<uint8> GenerateFlac(const std::vector<float>& Signal, uint32 NumOfChannels)
+	{
+		const uint32 NumOfFrames = static_cast<uint32>(Signal.size() / NumOfChannels);
+
+		std::vector<uint8> AudioData(RuntimeAudioImporter_Fixtures::GetFlacSize(NumOfChannels, NumOfFrames));
+		RuntimeAudioImporter_Fixtures::SynthesizeFlac(Signal.data(), NumOfChannels, NumOfFrames, SampleRate, AudioData.data());
+
+		return AudioData;
+	}
+
+	/**
+	 * Generate MP3 audio data made of MPEG-1 Layer III frames at 128 kbps carrying sparse Huffman-coded spectral values
+	 */
+	std::vector<uint8> GenerateMP3(uint32 NumOfChannels, uint32 NumOfFrames)
+	{
+		std::vector<uint8> AudioData(RuntimeAudioImporter_Fixtures::GetMP3Size(NumOfFrames));
+		RuntimeAudioImporter_Fixtures::SynthesizeMP3(NumOfChannels, NumOfFrames, AudioData.data());
+
+		return AudioData;
+	}
+
+	/**
+	 * Encode the signal to WAV with the specified format, the same way WAVTranscoder::Encode does
+	 */
+	std::vector<uint8> EncodeWAV(const std::vector<float>& Signal, uint32 NumOfChannels, drwav_uint32 WAVFormat, drwav_uint32 BitsPerSample)
+	{
+		const uint32 NumOfFrames = static_cast<uint32>(Signal.size() / NumOfChannels);
+
+		drwav_data_format Format;
+		Format.container = drwav_container_riff;
+		Format.format = WAVFormat;
+		Format.channels = NumOfChannels;
+		Format.sampleRate = SampleRate;
+		Format.bitsPerSample = BitsPerSample;
+
+		std::vector<uint8> Samples;
+		if (WAVFormat == DR_WAVE_FORMAT_PCM)
+		{
+			const std::vector<int16> Int16Signal = ConvertSignal<int16>(Signal);
+			Samples.assign(reinterpret_cast<const uint8*>(Int16Signal.data()), reinterpret_cast<const uint8*>(Int16Signal.data() + Int16Signal.size()));
+		}
+		else
+		{
+			Samples.assign(reinterpret_cast<const uint8*>(Signal.data()), reinterpret_cast<const uint8*>(Signal.data() + Signal.size()));
+		}
+
+		void* AudioData = nullptr;
+		size_t AudioDataSize = 0;
+
+		drwav Encoder;
+		drwav_init_memory_write(&Encoder, &AudioData, &AudioDataSize, &Format, nullptr);
+		drwav_write_pcm_frames(&Encoder, NumOfFrames, Samples.data());
+		drwav_uninit(&Encoder);
+
+		std::vector<uint8> Encoded(static_cast<uint8*>(AudioData), static_cast<uint8*>(AudioData) + AudioDataSize);
+		drwav_free(AudioData, nullptr);
+
+		return Encoded;
+	}
+
+#if RUNTIMEAUDIOIMPORTER_BENCHMARK_WITH_VORBIS
+	/**
+	 * Encode the signal to Ogg Vorbis, the same way VorbisTranscoder::Encode does
+	 */
+	std::vector<uint8> EncodeVorbis(const std::vector<float>& Signal, uint32 NumOfChannels, float Quality)
+	{
+		const uint32 NumOfFrames = static_cast<uint32>(Signal.size() / NumOfChannels);
+		constexpr uint32 MaxFramesPerWrite = 1024;
+
+		std::vector<uint8> Encoded;
+
+		vorbis_info VorbisInfo;
+		vorbis_info_init(&VorbisInfo);
+		vorbis_encode_init_vbr(&VorbisInfo, NumOfChannels, SampleRate, Quality);
+
+		vorbis_comment VorbisComment;
+		vorbis_comment_init(&VorbisComment);
+
+		vorbis_dsp_state VorbisDspState;
+		vorbis_analysis_init(&VorbisDspState, &VorbisInfo);
+
+		vorbis_block VorbisBlock;
+		vorbis_block_init(&VorbisDspState, &VorbisBlock);
+
+		ogg_stream_state OggStreamState;
+		ogg_stream_init(&OggStreamState, 0);
+
+		ogg_page OggPage;
+		ogg_packet OggPacket;
+
+		const auto WritePage = [&Encoded, &OggPage]()
+		{
+			Encoded.insert(Encoded.end(), OggPage.header, OggPage.header + OggPage.header_len);
+			Encoded.insert(Encoded.end(), OggPage.body, OggPage.body + OggPage.body_len);
+		};
+
+		{
+			ogg_packet Header, HeaderComment, HeaderCode;
+			vorbis_analysis_headerout(&VorbisDspState, &VorbisComment, &Header, &HeaderComment, &HeaderCode);
+			ogg_stream_packetin(&OggStreamState, &Header);
+			ogg_stream_packetin(&OggStreamState, &HeaderComment);
+			ogg_stream_packetin(&OggStreamState, &HeaderCode);
+
+			while (ogg_stream_flush(&OggStreamState, &OggPage) != 0)
+			{
+				WritePage();
+			}
+		}
+
+		uint32 FramesEncoded = 0;
+		bool bEndOfStream = false;
+
+		while (!bEndOfStream)
+		{
+			const uint32 FramesToEncode = FMath::Min(MaxFramesPerWrite, NumOfFrames - FramesEncoded);
+
+			if (FramesToEncode == 0)
+			{
+				vorbis_analysis_wrote(&VorbisDspState, 0);
+			}
+			else
+			{
+				float** AnalysisBuffer = vorbis_analysis_buffer(&VorbisDspState, FramesToEncode);
+
+				for (uint32 FrameIndex = 0; FrameIndex < FramesToEncode; ++FrameIndex)
+				{
+					const float* Frame = Signal.data() + static_cast<size_t>(FrameIndex + FramesEncoded) * NumOfChannels;
+
+					for (uint32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+					{
+						AnalysisBuffer[ChannelIndex][FrameIndex] = Frame[ChannelIndex];
+					}
+				}
+
+				vorbis_analysis_wrote(&VorbisDspState, FramesToEncode);
+				FramesEncoded += FramesToEncode;
+			}
+
+			while (vorbis_analysis_blockout(&VorbisDspState, &VorbisBlock) == 1)
+			{
+				vorbis_analysis(&VorbisBlock, nullptr);
+				vorbis_bitrate_addblock(&VorbisBlock);
+
+				while (vorbis_bitrate_flushpacket(&VorbisDspState, &OggPacket) != 0)
+				{
+					ogg_stream_packetin(&OggStreamState, &OggPacket);
+
+					while (!bEndOfStream && ogg_stream_pageout(&OggStreamState, &OggPage) != 0)
+					{
+						WritePage();
+						bEndOfStream = ogg_page_eos(&OggPage) != 0;
+					}
+				}
+			}
+
+			if (FramesToEncode == 0)
+			{
+				bEndOfStream = true;
+			}
+		}
+
+		while (ogg_stream_flush(&OggStreamState, &OggPage) != 0)
+		{
+			WritePage();
+		}
+
+		ogg_stream_clear(&OggStreamState);
+		vorbis_block_clear(&VorbisBlock);
+		vorbis_dsp_clear(&VorbisDspState);
+		vorbis_comment_clear(&VorbisComment);
+		vorbis_info_clear(&VorbisInfo);
+
+		return Encoded;
+	}
+#endif
+
+	/**
+	 * Decode the audio data to interleaved 32-bit float PCM, the same way the transcoders do
+	 *
+	 * @param Extension Format of the audio data: mp3, wav, flac or ogg
+	 * @param AudioData Encoded audio data
+	 * @param NumOfFrames Number of decoded frames
+	 * @param NumOfChannels Number of channels of the decoded frames
+	 * @return Whether the audio data was decoded or not
+	 */
+	bool Decode(const std::string& Extension, const std::vector<uint8>& AudioData, uint64& NumOfFrames, uint32& NumOfChannels)
+	{
+		std::vector<float> PCMData;
+
+		if (Extension == "wav")
+		{
+			drwav Decoder;
+			if (!drwav_init_memory(&Decoder, AudioData.data(), AudioData.size(), nullptr))
+			{
+				return false;
+			}
+
+			NumOfChannels = Decoder.channels;
+			PCMData.resize(Decoder.totalPCMFrameCount * Decoder.channels);
+			NumOfFrames = drwav_read_pcm_frames_f32(&Decoder, Decoder.totalPCMFrameCount, PCMData.data());
+			drwav_uninit(&Decoder);
+		}
+		else if (Extension == "flac")
+		{
+			drflac* Decoder = drflac_open_memory(AudioData.data(), AudioData.size(), nullptr);
+			if (Decoder == nullptr)
+			{
+				return false;
+			}
+
+			NumOfChannels = Decoder->channels;
+			PCMData.resize(Decoder->totalPCMFrameCount * Decoder->channels);
+			NumOfFrames = drflac_read_pcm_frames_f32(Decoder, Decoder->totalPCMFrameCount, PCMData.data());
+			drflac_close(Decoder);
+		}
+		else if (Extension == "mp3")
+		{
+			drmp3 Decoder;
+			if (!drmp3_init_memory(&Decoder, AudioData.data(), AudioData.size(), nullptr))
+			{
+				return false;
+			}
+
+			NumOfChannels = Decoder.channels;
+			const drmp3_uint64 TotalNumOfFrames = drmp3_get_pcm_frame_count(&Decoder);
+			PCMData.resize(TotalNumOfFrames * Decoder.channels);
+			NumOfFrames = drmp3_read_pcm_frames_f32(&Decoder, TotalNumOfFrames, PCMData.data());
+			drmp3_uninit(&Decoder);
+		}
+		else if (Extension == "ogg")
+		{
+			int32 ErrorCode = 0;
+			stb_vorbis* Decoder = stb_vorbis_open_memory(AudioData.data(), static_cast<int32>(AudioData.size()), &ErrorCode, nullptr);
+			if (Decoder == nullptr)
+			{
+				return false;
+			}
+
+			NumOfChannels = Decoder->channels;
+			PCMData.resize(static_cast<size_t>(stb_vorbis_stream_length_in_samples(Decoder)) * NumOfChannels);
+			NumOfFrames = stb_vorbis_get_samples_float_interleaved(Decoder, NumOfChannels, PCMData.data(), static_cast<int32>(PCMData.size()));
+			stb_vorbis_close(Decoder);
+		}
+		else
+		{
+			return false;
+		}
+
+		ResultSink = ResultSink + (PCMData.empty() ? 0.f : PCMData[PCMData.size() / 2]);
+		return NumOfFrames > 0;
+	}
+
+	/**
+	 * Benchmark the decoding of the audio data
+	 */
+	void BenchmarkDecode(const std::string& Name, const std::string& Extension, const std::vector<uint8>& AudioData)
+	{
+		uint64 NumOfFrames = 0;
+		uint32 NumOfChannels = 0;
+
+		if (!Decode(Extension, AudioData, NumOfFrames, NumOfChannels))
+		{
+			std::printf("%-40s unable to decode\n", Name.c_str());
+			return;
+		}
+
+		const double Time = Measure([&]()
+		{
+			uint64 DecodedNumOfFrames;
+			uint32 DecodedNumOfChannels;
+			Decode(Extension, AudioData, DecodedNumOfFrames, DecodedNumOfChannels);
+		});
+
+		ReportCodec(Name, Time, NumOfFrames, NumOfChannels);
+	}
+
+	/**
+	 * Get the lowercase extension of the file path
+	 */
+	std::string GetExtension(const std::string& FilePath)
+	{
+		std::string Extension = FilePath.substr(FilePath.find_last_of('.') + 1);
+		for (char& Character : Extension)
+		{
+			Character = static_cast<char>(std::tolower(static_cast<unsigned char>(Character)));
+		}
+
+		return Extension;
+	}
+}
+
+int main(int ArgC, char** ArgV)
+{
+	double Duration = 30.;
+	uint32 NumOfChannels = 2;
+	std::vector<std::string> FilePaths;
+
+	for (int32 ArgIndex = 1; ArgIndex + 1 < ArgC; ArgIndex += 2)
+	{
+		const std::string Argument = ArgV[ArgIndex];
+
+		if (Argument == "--duration")
+		{
+			Duration = std::atof(ArgV[ArgIndex + 1]);
+		}
+		else if (Argument == "--channels")
+		{
+			NumOfChannels = static_cast<uint32>(std::atoi(ArgV[ArgIndex + 1]));
+		}
+		else if (Argument == "--time")
+		{
+			MinMeasuringTime = std::atof(ArgV[ArgIndex + 1]);
+		}
+		else if (Argument == "--file")
+		{
+			FilePaths.push_back(ArgV[ArgIndex + 1]);
+		}
+		else
+		{
+			std::fprintf(stderr, "Unknown argument '%s'\n", Argument.c_str());
+			return 1;
+		}
+	}
+
+	if (Duration <= 0. || NumOfChannels == 0 || NumOfChannels > 8)
+	{
+		std::fprintf(stderr, "Invalid duration or number of channels\n");
+		return 1;
+	}
+
+	const uint32 NumOfFrames = static_cast<uint32>(Duration * SampleRate);
+	const std::vector<float> Signal = GenerateSignal(NumOfChannels, NumOfFrames);
+
+	std::printf("Signal: %u channel(s), %u Hz, %.1f seconds (%zu samples)\n\n", NumOfChannels, SampleRate, Duration, Signal.size());
+
+	std::printf("Kernels\n");
+	BenchmarkTranscodeRAWFrom<int16>(Signal);
+	BenchmarkTranscodeRAWFrom<int32>(Signal);
+	BenchmarkTranscodeRAWFrom<uint8>(Signal);
+	BenchmarkTranscodeRAWFrom<float>(Signal);
+	BenchmarkDeinterleave(Signal, NumOfChannels);
+
+	std::printf("\nEncoders\n");
+	{
+		const double Time = Measure([&]()
+		{
+			ResultSink = ResultSink + static_cast<float>(EncodeWAV(Signal, NumOfChannels, DR_WAVE_FORMAT_IEEE_FLOAT, 32).size());
+		});
+		ReportCodec("WAV 32-bit float", Time, NumOfFrames, NumOfChannels);
+	}
+#if RUNTIMEAUDIOIMPORTER_BENCHMARK_WITH_VORBIS
+	{
+		const double Time = Measure([&]()
+		{
+			ResultSink = ResultSink + static_cast<float>(EncodeVorbis(Signal, NumOfChannels, 0.5f).size());
+		});
+		ReportCodec("Ogg Vorbis (quality 50)", Time, NumOfFrames, NumOfChannels);
+	}
+#else
+	std::printf("%-40s skipped, built without libvorbis\n", "Ogg Vorbis");
+#endif
+
+	std::printf("\nDecoders\n");
+	BenchmarkDecode("WAV 16-bit PCM", "wav", EncodeWAV(Signal, NumOfChannels, DR_WAVE_FORMAT_PCM, 16));
+	BenchmarkDecode("WAV 32-bit float", "wav", EncodeWAV(Signal, NumOfChannels, DR_WAVE_FORMAT_IEEE_FLOAT, 32));
+	BenchmarkDecode("FLAC 16-bit (verbatim)", "flac", GenerateFlac(Signal, NumOfChannels));
+	if (NumOfChannels <= 2)
+	{
+		BenchmarkDecode("MP3 128 kbps (synthesized frames)", "mp3", GenerateMP3(NumOfChannels, NumOfFrames));
+	}
+#if RUNTIMEAUDIOIMPORTER_BENCHMARK_WITH_VORBIS
+	BenchmarkDecode("Ogg Vorbis (quality 50)", "ogg", EncodeVorbis(Signal, NumOfChannels, 0.5f));
+#endif
+
+	for (const std::string& FilePath : FilePaths)
+	{
+		std::ifstream File(FilePath, std::ios::binary);
+		if (!File)
+		{
+			std::printf("%-40s unable to read\n", FilePath.c_str());
+			continue;
+		}
+
+		const std::vector<uint8> AudioData{std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>()};
+		BenchmarkDecode(FilePath, GetExtension(FilePath), AudioData);
+	}
+
+	return 0;
+}
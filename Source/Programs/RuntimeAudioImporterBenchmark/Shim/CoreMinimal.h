@@ -0,0 +1,109 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+/**
+ * Minimal stand-ins for the engine types used by the header-only transcoding kernels, so that the kernels are benchmarked without the engine
+ * Logging, stats and tracing compile to nothing, so only the kernels themselves are measured
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+using int8 = int8_t;
+using int16 = int16_t;
+using int32 = int32_t;
+using int64 = int64_t;
+using uint8 = uint8_t;
+using uint16 = uint16_t;
+using uint32 = uint32_t;
+using uint64 = uint64_t;
+using SIZE_T = size_t;
+
+#define RUNTIMEAUDIOIMPORTER_API
+#define TEXT(Text) Text
+#define UE_LOG(...)
+#define SCOPE_CYCLE_COUNTER(...)
+
+template <typename A, typename B>
+struct TIsSame
+{
+	static constexpr bool Value = std::is_same<A, B>::value;
+};
+
+template <typename KeyType, typename ValueType>
+struct TTuple
+{
+	TTuple(KeyType InKey, ValueType InValue)
+		: Key(InKey)
+	  , Value(InValue)
+	{
+	}
+
+	KeyType Key;
+	ValueType Value;
+};
+
+struct FMemory
+{
+	static void* Malloc(SIZE_T Size, uint32 Alignment = 0)
+	{
+		return Alignment > alignof(std::max_align_t) ? std::aligned_alloc(Alignment, (Size + Alignment - 1) / Alignment * Alignment) : std::malloc(Size);
+	}
+
+	static void* Realloc(void* Original, SIZE_T Size)
+	{
+		return std::realloc(Original, Size);
+	}
+
+	static void Free(void* Original)
+	{
+		std::free(Original);
+	}
+
+	static void* Memcpy(void* Dest, const void* Src, SIZE_T Size)
+	{
+		return std::memcpy(Dest, Src, Size);
+	}
+
+	static void* Memset(void* Dest, uint8 Char, SIZE_T Size)
+	{
+		return std::memset(Dest, Char, Size);
+	}
+};
+
+template <typename ElementType>
+class TArray
+{
+public:
+	TArray() = default;
+
+	TArray(const ElementType* Data, int32 Num)
+		: Elements(Data, Data + Num)
+	{
+	}
+
+	ElementType* GetData()
+	{
+		return Elements.data();
+	}
+
+	const ElementType* GetData() const
+	{
+		return Elements.data();
+	}
+
+	int32 Num() const
+	{
+		return static_cast<int32>(Elements.size());
+	}
+
+private:
+	std::vector<ElementType> Elements;
+};
+
+#include "Math/UnrealMathUtility.h"
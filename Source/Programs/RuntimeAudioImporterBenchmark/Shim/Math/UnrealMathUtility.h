@@ -0,0 +1,40 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <cmath>
+
+#define PI (3.1415926535897932f)
+
+struct FMath
+{
+	template <typename T>
+	static constexpr T Clamp(const T X, const T Min, const T Max)
+	{
+		return X < Min ? Min : X < Max ? X : Max;
+	}
+
+	template <typename T>
+	static constexpr T Min(const T A, const T B)
+	{
+		return A < B ? A : B;
+	}
+
+	template <typename T>
+	static constexpr T Max(const T A, const T B)
+	{
+		return A > B ? A : B;
+	}
+
+	static double Sin(double Value)
+	{
+		return std::sin(Value);
+	}
+
+	static int32 RoundToInt(double Value)
+	{
+		return static_cast<int32>(std::floor(Value + 0.5));
+	}
+};
@@ -0,0 +1,8 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#define RUNTIMEAUDIOIMPORTER_TRACE_SCOPE(Name)
+#define RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED(Name, Size)
@@ -0,0 +1,143 @@
+// Georgy Treshchev 2022.
+
+#include "ImportedAudioMemoryManager.h"
+#include "ImportedSoundWave.h"
+#include "RuntimeAudioImporterDefines.h"
+
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	/** Memory budget for the PCM data of imported sound waves, in megabytes. Zero means there is no budget */
+	int32 MemoryBudgetMB = 0;
+
+	FAutoConsoleVariableRef CVarMemoryBudgetMB(
+		TEXT("au.RuntimeAudioImporter.MemoryBudgetMB"),
+		MemoryBudgetMB,
+		TEXT("Memory budget for the PCM data of imported sound waves, in megabytes. When exceeded, the PCM data of the least recently played sound waves is evicted and re-decoded on the next play.\n")
+		TEXT("0: no budget (default)"),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*)
+		{
+			// Console variables may be changed from any thread, while the manager is game thread only
+			AsyncTask(ENamedThreads::GameThread, []()
+			{
+				FImportedAudioMemoryManager::Get().EnforceBudget();
+			});
+		}),
+		ECVF_Default);
+}
+
+FImportedAudioMemoryManager& FImportedAudioMemoryManager::Get()
+{
+	static FImportedAudioMemoryManager MemoryManager;
+	return MemoryManager;
+}
+
+void FImportedAudioMemoryManager::Register(UImportedSoundWave* SoundWave)
+{
+	check(IsInGameThread());
+
+	if (SoundWave == nullptr)
+	{
+		return;
+	}
+
+	SoundWaves.AddUnique(SoundWave);
+
+	EnforceBudget();
+}
+
+void FImportedAudioMemoryManager::Unregister(UImportedSoundWave* SoundWave)
+{
+	check(IsInGameThread());
+
+	SoundWaves.RemoveAllSwap([SoundWave](const TWeakObjectPtr<UImportedSoundWave>& TrackedSoundWave)
+	{
+		return !TrackedSoundWave.IsValid() || TrackedSoundWave.Get() == SoundWave;
+	});
+}
+
+void FImportedAudioMemoryManager::EnforceBudget()
+{
+	check(IsInGameThread());
+
+	const int64 Budget = GetBudget();
+	if (Budget <= 0)
+	{
+		return;
+	}
+
+	int64 ResidentSize = GetResidentSize();
+	if (ResidentSize <= Budget)
+	{
+		return;
+	}
+
+	// Collecting the sound waves that can be evicted, least recently played first
+	TArray<UImportedSoundWave*> EvictionCandidates;
+	for (const TWeakObjectPtr<UImportedSoundWave>& SoundWave : SoundWaves)
+	{
+		if (SoundWave.IsValid() && SoundWave->CanEvictPCMData())
+		{
+			EvictionCandidates.Add(SoundWave.Get());
+		}
+	}
+
+	EvictionCandidates.Sort([](const UImportedSoundWave& A, const UImportedSoundWave& B)
+	{
+		return A.GetLastPlaybackCycles() < B.GetLastPlaybackCycles();
+	});
+
+	for (UImportedSoundWave* SoundWave : EvictionCandidates)
+	{
+		if (ResidentSize <= Budget)
+		{
+			break;
+		}
+
+		ResidentSize -= SoundWave->EvictPCMData();
+	}
+
+	if (ResidentSize > Budget)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to fit the PCM data of imported sound waves into the memory budget of '%lld' bytes: '%lld' bytes are still resident"), Budget, ResidentSize);
+	}
+}
+
+int64 FImportedAudioMemoryManager::GetBudget() const
+{
+	return static_cast<int64>(FMath::Max(MemoryBudgetMB, 0)) * 1024 * 1024;
+}
+
+bool FImportedAudioMemoryManager::IsBudgetEnabled() const
+{
+	return GetBudget() > 0;
+}
+
+int64 FImportedAudioMemoryManager::GetResidentSize() const
+{
+	int64 ResidentSize = 0;
+	TSet<const void*> CountedAllocations;
+
+	for (const TWeakObjectPtr<UImportedSoundWave>& SoundWave : SoundWaves)
+	{
+		if (!SoundWave.IsValid() || !SoundWave->IsPCMDataResident())
+		{
+			continue;
+		}
+
+		const FSharedPCMBuffer& PCMData = SoundWave->PCMBufferInfo.PCMData;
+
+		// Slices share the allocation of the sound wave they were created from
+		bool bAlreadyCounted = false;
+		CountedAllocations.Add(PCMData.GetAllocationId(), &bAlreadyCounted);
+
+		if (!bAlreadyCounted)
+		{
+			ResidentSize += PCMData.GetAllocationSize();
+		}
+	}
+
+	return ResidentSize;
+}
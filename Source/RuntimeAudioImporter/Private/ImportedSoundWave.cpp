@@ -1,24 +1,276 @@
 // Georgy Treshchev 2022.
 
 #include "ImportedSoundWave.h"
+#include "ImportedAudioMemoryManager.h"
 #include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterLibrary.h"
+#include "Processors/WaveformPeaksProcessor.h"
+#include "Processors/AudioVectorMath.h"
+#include "Processors/SilenceProcessor.h"
 
 #include "Async/Async.h"
+#include "Misc/ScopeExit.h"
+
+namespace
+{
+	/** Number of samples mixed at a time during the loop crossfade. Kept on the stack to avoid allocations on the audio render thread */
+	constexpr uint32 CrossfadeChunkSize = 1024;
+}
 
 void UImportedSoundWave::BeginDestroy()
 {
 	UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Imported sound wave ('%s') data will be cleared because it is being unloaded"), *GetName());
 
+	FImportedAudioMemoryManager::Get().Unregister(this);
+
 	Super::BeginDestroy();
 }
 
+void UImportedSoundWave::OnBeginGenerate()
+{
+	Super::OnBeginGenerate();
+
+	// Counting the generator before checking the residency, which pairs with the eviction that publishes the residency before checking the generators
+	++NumOfActiveGenerators;
+	LastPlaybackCycles.Store(FPlatformTime::Cycles64(), EMemoryOrder::Relaxed);
+
+	if (!bPCMDataResident)
+	{
+		ReloadPCMData();
+	}
+}
+
+void UImportedSoundWave::OnEndGenerate()
+{
+	--NumOfActiveGenerators;
+	LastPlaybackCycles.Store(FPlatformTime::Cycles64(), EMemoryOrder::Relaxed);
+
+	Super::OnEndGenerate();
+}
+
 void UImportedSoundWave::ReleaseMemory()
 {
+	check(IsInGameThread());
+
 	UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Releasing memory for the sound wave '%s'"), *GetName());
 
+	// Without the encoded audio data, the released PCM data is never re-decoded
+	EncodedAudioSource.Reset();
+
+	bPCMDataReleasePending = true;
+	TryReleasePCMData();
+}
+
+void UImportedSoundWave::TryReleasePCMData()
+{
+	check(IsInGameThread());
+
+	if (!bPCMDataReleasePending)
+	{
+		return;
+	}
+
+	// Publishing the release before checking the generation calls, the same way as the eviction, so that either the audio render thread stops reading the PCM data or this check sees the call
+	bPCMDataResident = false;
+
+	if (NumOfGenerateCalls.Load() > 0)
+	{
+		return;
+	}
+
+	// Releasing the reference on a background thread. The memory is freed once no other sound wave or slice shares it
+	FSharedPCMBuffer ReleasedPCMData = PCMBufferInfo.PCMData;
 	PCMBufferInfo.PCMData.Empty();
+	PCMBufferInfo.SilentSpans.Empty();
+
+	// The playback finishes instead of generating silence
+	PCMBufferInfo.PCMNumOfFrames = 0;
 
-	PCMBufferInfo.~FPCMStruct();
+	bPCMDataReleasePending = false;
+	bPCMDataReloadPending = false;
+	bPCMDataResident = true;
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ReleasedPCMData = MoveTemp(ReleasedPCMData)]() mutable
+	{
+		ReleasedPCMData.Empty();
+	});
+}
+
+bool UImportedSoundWave::IsPCMDataResident() const
+{
+	return bPCMDataResident;
+}
+
+bool UImportedSoundWave::CanEvictPCMData() const
+{
+	return EncodedAudioSource.IsValid() && bPCMDataResident && !bPCMDataReloadPending && NumOfActiveGenerators.Load() == 0 && PCMBufferInfo.PCMData.IsUnique();
+}
+
+int64 UImportedSoundWave::EvictPCMData()
+{
+	check(IsInGameThread());
+
+	if (!CanEvictPCMData())
+	{
+		return 0;
+	}
+
+	// Publishing the eviction before checking the generators, so that either the audio render thread sees the eviction or this check sees the generator
+	bPCMDataResident = false;
+
+	if (NumOfActiveGenerators.Load() > 0)
+	{
+		bPCMDataResident = true;
+		return 0;
+	}
+
+	const int64 EvictedSize = PCMBufferInfo.PCMData.GetAllocationSize();
+
+	// Freeing the memory on a background thread, since freeing large buffers may stall the game thread. The number of frames is kept for seeking while the data is evicted
+	FSharedPCMBuffer EvictedPCMData = PCMBufferInfo.PCMData;
+	PCMBufferInfo.PCMData.Empty();
+	PCMBufferInfo.SilentSpans.Empty();
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [EvictedPCMData = MoveTemp(EvictedPCMData)]() mutable
+	{
+		EvictedPCMData.Empty();
+	});
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Evicted '%lld' bytes of PCM data of the imported sound wave '%s'"), EvictedSize, *GetName());
+
+	return EvictedSize;
+}
+
+uint64 UImportedSoundWave::GetLastPlaybackCycles() const
+{
+	return LastPlaybackCycles.Load(EMemoryOrder::Relaxed);
+}
+
+void UImportedSoundWave::MarkAsUsed()
+{
+	LastPlaybackCycles.Store(FPlatformTime::Cycles64(), EMemoryOrder::Relaxed);
+}
+
+void UImportedSoundWave::ReloadPCMData()
+{
+	if (bPCMDataReloadPending.Exchange(true))
+	{
+		return;
+	}
+
+	// The encoded audio data is owned by the game thread, so the reload starts there
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UImportedSoundWave>(this)]()
+	{
+		UImportedSoundWave* SoundWave = WeakThis.Get();
+		if (SoundWave == nullptr)
+		{
+			return;
+		}
+
+		// The eviction may have been cancelled in the meantime. A pending release publishes the residency by itself once the PCM data is freed
+		if (SoundWave->bPCMDataResident || SoundWave->bPCMDataReleasePending)
+		{
+			SoundWave->bPCMDataReloadPending = SoundWave->bPCMDataReleasePending.Load();
+			return;
+		}
+
+		// The memory was released manually, so playback finishes instead of generating silence
+		if (!SoundWave->EncodedAudioSource.IsValid())
+		{
+			UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to re-decode the evicted PCM data of the imported sound wave '%s' because its memory has been released"), *SoundWave->GetName());
+			SoundWave->PCMBufferInfo.PCMNumOfFrames = 0;
+			SoundWave->bPCMDataResident = true;
+			SoundWave->bPCMDataReloadPending = false;
+			return;
+		}
+
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [WeakThis, EncodedAudioSource = SoundWave->EncodedAudioSource]()
+		{
+			// Only the stages that change the PCM data are needed, since the analysis data was kept
+			FAudioImportSettings ImportSettings = EncodedAudioSource->ImportSettings;
+			{
+				ImportSettings.bGenerateSpectrogram = false;
+				ImportSettings.bGenerateWaveformPeaks = false;
+				ImportSettings.bAnalyzeLoudness = ImportSettings.bAnalyzeLoudness && ImportSettings.LoudnessNormalization == ELoudnessNormalization::BakeIntoAudioData;
+			}
+
+			uint8* EncodedAudioDataPtr = static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(EncodedAudioSource->AudioData.Num()), EncodedAudioSource->AudioData.GetData(), EncodedAudioSource->AudioData.Num()));
+			FEncodedAudioStruct EncodedAudioInfo(EncodedAudioDataPtr, EncodedAudioSource->AudioData.Num(), EncodedAudioSource->AudioFormat);
+
+			FDecodedAudioStruct DecodedAudioInfo;
+			const bool bSucceeded{URuntimeAudioImporterLibrary::DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo) && URuntimeAudioImporterLibrary::ProcessDecodedAudioData(DecodedAudioInfo, ImportSettings)};
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, bSucceeded, PCMInfo = MoveTemp(DecodedAudioInfo.PCMInfo)]()
+			{
+				UImportedSoundWave* SoundWave = WeakThis.Get();
+				if (SoundWave == nullptr)
+				{
+					return;
+				}
+
+				// The memory was released while re-decoding, so the re-decoded PCM data is dropped
+				if (!SoundWave->EncodedAudioSource.IsValid())
+				{
+					return;
+				}
+
+				if (!bSucceeded)
+				{
+					UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to re-decode the evicted PCM data of the imported sound wave '%s'"), *SoundWave->GetName());
+					SoundWave->PCMBufferInfo.PCMNumOfFrames = 0;
+				}
+				else
+				{
+					// The audio render thread does not touch the PCM data until it is published as resident
+					SoundWave->PCMBufferInfo.PCMData = PCMInfo.PCMData;
+					SoundWave->PCMBufferInfo.SilentSpans = PCMInfo.SilentSpans;
+					SoundWave->PCMBufferInfo.PCMNumOfFrames = PCMInfo.PCMNumOfFrames;
+				}
+
+				SoundWave->bPCMDataResident = true;
+				SoundWave->bPCMDataReloadPending = false;
+
+				// The re-decoded data may push other sound waves out of the budget
+				FImportedAudioMemoryManager::Get().EnforceBudget();
+			});
+		});
+	});
+}
+
+UImportedSoundWave* UImportedSoundWave::CreateSlice(float StartTime, float EndTime)
+{
+	const uint32 StartFrame = static_cast<uint32>(FMath::Max(static_cast<double>(StartTime) * SampleRate, 0.));
+	const uint32 EndFrame = EndTime < 0 ? PCMBufferInfo.PCMNumOfFrames : FMath::Min(static_cast<uint32>(static_cast<double>(EndTime) * SampleRate), PCMBufferInfo.PCMNumOfFrames);
+
+	if (!IsPCMDataResident())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to create a slice of the imported sound wave '%s' because its PCM data has been evicted. It is being re-decoded, try again once it is resident"), *GetName());
+		ReloadPCMData();
+		return nullptr;
+	}
+
+	if (StartFrame >= EndFrame || PCMBufferInfo.PCMData.GetView().GetData() == nullptr)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to create a slice of the imported sound wave '%s' from '%f' to '%f' because its duration is '%f'"), *GetName(), StartTime, EndTime, Duration);
+		return nullptr;
+	}
+
+	FDecodedAudioStruct DecodedAudioInfo;
+	{
+		DecodedAudioInfo.PCMInfo = SilenceProcessor::Slice(PCMBufferInfo, NumChannels, StartFrame, EndFrame - StartFrame);
+		DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels = NumChannels;
+		DecodedAudioInfo.SoundWaveBasicInfo.SampleRate = SamplingRate;
+		DecodedAudioInfo.SoundWaveBasicInfo.Duration = static_cast<float>(EndFrame - StartFrame) / SamplingRate;
+		DecodedAudioInfo.PlaybackGain = PlaybackGain;
+	}
+
+	UImportedSoundWave* SlicedSoundWave = NewObject<UImportedSoundWave>(GetTransientPackage(), GetClass());
+
+	URuntimeAudioImporterLibrary::FillSoundWaveBasicInfo(SlicedSoundWave, DecodedAudioInfo);
+	URuntimeAudioImporterLibrary::FillPCMData(SlicedSoundWave, DecodedAudioInfo);
+	URuntimeAudioImporterLibrary::FillAnalysisData(SlicedSoundWave, DecodedAudioInfo);
+
+	return SlicedSoundWave;
 }
 
 bool UImportedSoundWave::RewindPlaybackTime(const float PlaybackTime)
@@ -40,17 +292,73 @@ bool UImportedSoundWave::ChangeCurrentFrameCount(const uint32 NumOfFrames)
 		return false;
 	}
 
-	CurrentNumOfFrames = NumOfFrames;
+	// Publishing the target before submitting the command, so that the position is reported right away and the counter never goes negative
+	PendingSeekNumOfFrames = NumOfFrames;
+	++NumOfPendingSeeks;
 
-	// Setting "PlaybackFinishedBroadcast" to "false" in order to re-broadcast the "OnAudioPlaybackFinished" delegate again
-	PlaybackFinishedBroadcast = false;
+	PlaybackCommands.Enqueue(FPlaybackCommand{EPlaybackCommandType::Seek, NumOfFrames, 0, 0});
 
 	return true;
 }
 
+bool UImportedSoundWave::SetLoopRegion(float StartTime, float EndTime, float CrossfadeDuration)
+{
+	if (StartTime < 0 || CrossfadeDuration < 0)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to set the loop region of the imported sound wave '%s' from '%f' to '%f' with crossfade duration '%f'"), *GetName(), StartTime, EndTime, CrossfadeDuration);
+		return false;
+	}
+
+	const uint32 StartFrame = static_cast<uint32>(static_cast<double>(StartTime) * SampleRate);
+	const uint32 EndFrame = EndTime < 0 ? PCMBufferInfo.PCMNumOfFrames : static_cast<uint32>(static_cast<double>(EndTime) * SampleRate);
+
+	return SetLoopRegionFrames(StartFrame, EndFrame, static_cast<uint32>(static_cast<double>(CrossfadeDuration) * SampleRate));
+}
+
+bool UImportedSoundWave::SetLoopRegionFrames(uint32 StartFrame, uint32 EndFrame, uint32 NumOfCrossfadeFrames)
+{
+	if (StartFrame >= EndFrame || EndFrame > PCMBufferInfo.PCMNumOfFrames)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to set the loop region of the imported sound wave '%s' from frame '%d' to frame '%d' because the total number of frames is '%d'"), *GetName(), StartFrame, EndFrame, PCMBufferInfo.PCMNumOfFrames);
+		return false;
+	}
+
+	// The crossfade mixes in the frames leading into the loop start, so there must be enough of them, and it cannot be longer than the loop itself
+	NumOfCrossfadeFrames = FMath::Min3(NumOfCrossfadeFrames, StartFrame, EndFrame - StartFrame);
+
+	LoopRegion = FLoopRegionStruct{StartFrame, EndFrame};
+	PlaybackCommands.Enqueue(FPlaybackCommand{EPlaybackCommandType::SetLoopRegion, StartFrame, EndFrame, NumOfCrossfadeFrames});
+
+	return true;
+}
+
+void UImportedSoundWave::ClearLoopRegion()
+{
+	LoopRegion.Reset();
+	PlaybackCommands.Enqueue(FPlaybackCommand{EPlaybackCommandType::ClearLoopRegion, 0, 0, 0});
+}
+
+bool UImportedSoundWave::GetLoopRegion(float& StartTime, float& EndTime) const
+{
+	if (!LoopRegion.IsSet())
+	{
+		return false;
+	}
+
+	StartTime = static_cast<float>(LoopRegion->StartFrame) / SampleRate;
+	EndTime = static_cast<float>(LoopRegion->EndFrame) / SampleRate;
+
+	return true;
+}
+
+int32 UImportedSoundWave::GetCurrentNumOfFrames() const
+{
+	return static_cast<int32>(NumOfPendingSeeks.Load() > 0 ? PendingSeekNumOfFrames.Load() : PlaybackNumOfFrames.Load());
+}
+
 float UImportedSoundWave::GetPlaybackTime() const
 {
-	return static_cast<float>(CurrentNumOfFrames) / SampleRate;
+	return static_cast<float>(GetCurrentNumOfFrames()) / SampleRate;
 }
 
 float UImportedSoundWave::GetDurationConst() const
@@ -77,68 +385,334 @@ bool UImportedSoundWave::IsPlaybackFinished()
 	return GetPlaybackPercentage() == 100 && PCMBufferInfo.PCMData.GetView().GetData() != nullptr && PCMBufferInfo.PCMNumOfFrames > 0 && PCMBufferInfo.PCMData.GetView().Num() > 0;
 }
 
+bool UImportedSoundWave::EnablePCMTap(float BufferDuration)
+{
+	if (NumChannels <= 0 || SamplingRate <= 0 || BufferDuration <= 0)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to enable the PCM tap for the imported sound wave '%s' with buffer duration '%f', number of channels '%d' and sample rate '%d'"), *GetName(), BufferDuration, NumChannels, SamplingRate);
+		return false;
+	}
+
+	// The buffer is never reallocated, since the audio render thread may be writing to it
+	if (!PCMTapBuffer.IsValid())
+	{
+		PCMTapBuffer = MakeUnique<FPCMRingBuffer>(FMath::CeilToInt(BufferDuration * SamplingRate) * NumChannels);
+	}
+
+	bPCMTapEnabled = true;
+
+	return true;
+}
+
+void UImportedSoundWave::DisablePCMTap()
+{
+	bPCMTapEnabled = false;
+}
+
+int32 UImportedSoundWave::ReadPCMTap(TArray<float>& PCMData, int32 MaxNumOfFrames)
+{
+	PCMData.SetNumUninitialized(FMath::Max(MaxNumOfFrames, 0) * NumChannels, false);
+
+	const int32 NumOfReadFrames = ReadPCMTapToBuffer(PCMData.GetData(), MaxNumOfFrames);
+	PCMData.SetNum(NumOfReadFrames * NumChannels, false);
+
+	return NumOfReadFrames;
+}
+
+int32 UImportedSoundWave::ReadPCMTapToBuffer(float* OutPCMData, int32 MaxNumOfFrames)
+{
+	if (!PCMTapBuffer.IsValid() || MaxNumOfFrames <= 0 || NumChannels <= 0)
+	{
+		return 0;
+	}
+
+	return PCMTapBuffer->Pop(OutPCMData, MaxNumOfFrames * NumChannels, NumChannels) / NumChannels;
+}
+
+int32 UImportedSoundWave::GetPCMTapNumOfFrames() const
+{
+	return PCMTapBuffer.IsValid() && NumChannels > 0 ? PCMTapBuffer->Num() / NumChannels : 0;
+}
+
+bool UImportedSoundWave::GetSpectrumAtTime(float Time, TArray<float>& Magnitudes) const
+{
+	if (!SpectrogramInfo.IsValid())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to get the spectrum of the imported sound wave '%s' because the spectrogram was not generated during import"), *GetName());
+		return false;
+	}
+
+	const TArrayView<const float> Spectrum{SpectrogramInfo->GetFrameAtTime(Time)};
+	Magnitudes = TArray<float>(Spectrum.GetData(), Spectrum.Num());
+
+	return Spectrum.Num() > 0;
+}
+
+bool UImportedSoundWave::GetSpectrumAtPlaybackTime(TArray<float>& Magnitudes) const
+{
+	return GetSpectrumAtTime(GetPlaybackTime(), Magnitudes);
+}
+
+bool UImportedSoundWave::GetWaveformPeaks(int32 ChannelIndex, float StartTime, float EndTime, int32 NumOfPeaks, TArray<FWaveformPeak>& Peaks) const
+{
+	if (!WaveformPeaksInfo.IsValid())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to get the waveform peaks of the imported sound wave '%s' because they were not generated during import"), *GetName());
+		return false;
+	}
+
+	const int64 StartFrame = static_cast<int64>(static_cast<double>(StartTime) * SampleRate);
+	const int64 EndFrame = EndTime < 0 ? WaveformPeaksInfo->NumOfFrames : static_cast<int64>(static_cast<double>(EndTime) * SampleRate);
+
+	// Sparse PCM data cannot be indexed directly, so the finest peak level is used for close zoom levels instead
+	const float* PCMData = PCMBufferInfo.SilentSpans.Num() == 0 ? reinterpret_cast<const float*>(PCMBufferInfo.PCMData.GetView().GetData()) : nullptr;
+
+	return WaveformPeaksProcessor::GetPeaks(*WaveformPeaksInfo, PCMData, ChannelIndex, StartFrame, EndFrame, NumOfPeaks, Peaks);
+}
+
+bool UImportedSoundWave::GetLoudnessInfo(FLoudnessInfo& OutLoudnessInfo) const
+{
+	if (!LoudnessInfo.IsSet())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to get the loudness of the imported sound wave '%s' because it was not analyzed during import"), *GetName());
+		return false;
+	}
+
+	OutLoudnessInfo = LoudnessInfo.GetValue();
+	return true;
+}
+
+void UImportedSoundWave::ApplyPlaybackCommands()
+{
+	FPlaybackCommand Command;
+	while (PlaybackCommands.Dequeue(Command))
+	{
+		switch (Command.Type)
+		{
+		case EPlaybackCommandType::Seek:
+			{
+				// Storing the new position before releasing the pending seek, so that the old position is never reported in between
+				PlaybackNumOfFrames.Store(Command.StartFrame);
+				--NumOfPendingSeeks;
+
+				// Re-arming the "OnAudioPlaybackFinished" delegate to broadcast it again
+				bPlaybackFinished = false;
+				break;
+			}
+		case EPlaybackCommandType::SetLoopRegion:
+			{
+				ActiveLoopRegion = FLoopRegionStruct{Command.StartFrame, Command.EndFrame};
+				NumOfActiveLoopCrossfadeFrames = Command.NumOfCrossfadeFrames;
+				bLoopRegionActive = true;
+				break;
+			}
+		case EPlaybackCommandType::ClearLoopRegion:
+			{
+				bLoopRegionActive = false;
+				break;
+			}
+		}
+	}
+}
+
+bool UImportedSoundWave::IsLoopingAt(uint32 Frame) const
+{
+	return bLoopRegionActive && Frame < ActiveLoopRegion.EndFrame && ActiveLoopRegion.EndFrame <= PCMBufferInfo.PCMNumOfFrames;
+}
+
+uint32 UImportedSoundWave::GenerateFrames(uint32 StartFrame, uint32 NumOfFrames, float* OutData) const
+{
+	uint32 CurrentFrame = StartFrame;
+
+	// Copying the timeline in segments that end either at the loop region end or at the end of the PCM data
+	while (NumOfFrames > 0)
+	{
+		const bool bLooping = IsLoopingAt(CurrentFrame);
+		const uint32 SegmentEndFrame = bLooping ? ActiveLoopRegion.EndFrame : PCMBufferInfo.PCMNumOfFrames;
+		const uint32 NumOfSegmentFrames = FMath::Min(NumOfFrames, SegmentEndFrame - CurrentFrame);
+
+		SilenceProcessor::CopyFrames(PCMBufferInfo, NumChannels, CurrentFrame, NumOfSegmentFrames, OutData);
+
+		if (bLooping && NumOfActiveLoopCrossfadeFrames > 0)
+		{
+			MixLoopCrossfade(CurrentFrame, NumOfSegmentFrames, OutData);
+		}
+
+		OutData += NumOfSegmentFrames * NumChannels;
+		NumOfFrames -= NumOfSegmentFrames;
+		CurrentFrame += NumOfSegmentFrames;
+
+		// Jumping back right after the last frame of the loop region, within the same block
+		if (bLooping && CurrentFrame == ActiveLoopRegion.EndFrame)
+		{
+			CurrentFrame = ActiveLoopRegion.StartFrame;
+		}
+	}
+
+	return CurrentFrame;
+}
+
+void UImportedSoundWave::MixLoopCrossfade(uint32 StartFrame, uint32 NumOfFrames, float* OutData) const
+{
+	const uint32 CrossfadeStartFrame = ActiveLoopRegion.EndFrame - NumOfActiveLoopCrossfadeFrames;
+	const uint32 FirstFrame = FMath::Max(StartFrame, CrossfadeStartFrame);
+	const uint32 EndFrame = StartFrame + NumOfFrames;
+
+	if (FirstFrame >= EndFrame || static_cast<uint32>(NumChannels) > CrossfadeChunkSize)
+	{
+		return;
+	}
+
+	// The frames leading into the loop start are faded in, so that playback continues seamlessly from the loop start after the jump
+	float FadeInData[CrossfadeChunkSize];
+	const uint32 NumOfChunkFrames = CrossfadeChunkSize / NumChannels;
+
+	for (uint32 ChunkFrame = FirstFrame; ChunkFrame < EndFrame; ChunkFrame += NumOfChunkFrames)
+	{
+		const uint32 NumOfFramesInChunk = FMath::Min(NumOfChunkFrames, EndFrame - ChunkFrame);
+		const uint32 CrossfadeIndex = ChunkFrame - CrossfadeStartFrame;
+
+		SilenceProcessor::CopyFrames(PCMBufferInfo, NumChannels, ActiveLoopRegion.StartFrame - NumOfActiveLoopCrossfadeFrames + CrossfadeIndex, NumOfFramesInChunk, FadeInData);
+
+		float* ChunkData = OutData + static_cast<int64>(ChunkFrame - StartFrame) * NumChannels;
+
+		for (uint32 FrameIndex = 0; FrameIndex < NumOfFramesInChunk; ++FrameIndex)
+		{
+			// Equal-power fade, which keeps the loudness constant for uncorrelated material such as ambience
+			float FadeInGain, FadeOutGain;
+			FMath::SinCos(&FadeInGain, &FadeOutGain, (CrossfadeIndex + FrameIndex + 0.5f) / NumOfActiveLoopCrossfadeFrames * HALF_PI);
+
+			for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+			{
+				const int32 SampleIndex = FrameIndex * NumChannels + ChannelIndex;
+				ChunkData[SampleIndex] = ChunkData[SampleIndex] * FadeOutGain + FadeInData[SampleIndex] * FadeInGain;
+			}
+		}
+	}
+}
+
 int32 UImportedSoundWave::OnGeneratePCMAudio(TArray<uint8>& OutAudio, int32 NumSamples)
 {
+	SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_GeneratePCMAudio);
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE("UImportedSoundWave::OnGeneratePCMAudio");
+
+	// Seeks are applied at block boundaries only, so a block is always generated from a single consistent position
+	ApplyPlaybackCommands();
+
+	// Counting this call as a generator, so that the PCM data cannot be evicted or released while it is being read
+	++NumOfActiveGenerators;
+	++NumOfGenerateCalls;
+	ON_SCOPE_EXIT
+	{
+		--NumOfActiveGenerators;
+
+		// The release counts on the last call in progress to retry it
+		if (--NumOfGenerateCalls == 0 && bPCMDataReleasePending)
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UImportedSoundWave>(this)]()
+			{
+				if (UImportedSoundWave* SoundWave = WeakThis.Get())
+				{
+					SoundWave->TryReleasePCMData();
+				}
+			});
+		}
+	};
+
+	LastPlaybackCycles.Store(FPlatformTime::Cycles64(), EMemoryOrder::Relaxed);
+
+	// Generating silence while the evicted PCM data is being re-decoded, without advancing the playback position
+	if (!bPCMDataResident)
+	{
+		ReloadPCMData();
+
+		OutAudio.SetNumZeroed(NumSamples * sizeof(float), false);
+		return NumSamples;
+	}
+
+	// Only the audio render thread writes the position, so it can be read once and stored back after the block
+	const uint32 StartNumOfFrames = PlaybackNumOfFrames.Load(EMemoryOrder::Relaxed);
+
 	// Ensure there is enough number of frames. Lack of frames means audio playback has finished
-	if (static_cast<uint32>(CurrentNumOfFrames) >= PCMBufferInfo.PCMNumOfFrames)
+	if (StartNumOfFrames >= PCMBufferInfo.PCMNumOfFrames)
 	{
-		AsyncTask(ENamedThreads::GameThread, [this]()
+		// Posting the game thread task only once per transition to the finished state
+		if (!bPlaybackFinished.Exchange(true))
 		{
-			if (!PlaybackFinishedBroadcast)
+			AsyncTask(ENamedThreads::GameThread, [this]()
 			{
 				UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Playback of the sound wave '%s' has been completed"), *GetName());
 
-				PlaybackFinishedBroadcast = true;
-
 				if (OnAudioPlaybackFinishedNative.IsBound())
 				{
 					OnAudioPlaybackFinishedNative.Broadcast();
 				}
-				
+
 				if (OnAudioPlaybackFinished.IsBound())
 				{
 					OnAudioPlaybackFinished.Broadcast();
 				}
-			}
-		});
+			});
+		}
 
 		return 0;
 	}
 
-	// Getting the remaining number of samples if the required number of samples is greater than the total available number
-	if (static_cast<uint32>(CurrentNumOfFrames) + static_cast<uint32>(NumSamples) / static_cast<uint32>(NumChannels) >= PCMBufferInfo.PCMNumOfFrames)
+	// Getting the remaining number of samples if the required number of samples is greater than the total available number. Looping playback never runs out of frames
+	if (!IsLoopingAt(StartNumOfFrames) && StartNumOfFrames + static_cast<uint32>(NumSamples) / static_cast<uint32>(NumChannels) >= PCMBufferInfo.PCMNumOfFrames)
 	{
-		NumSamples = (PCMBufferInfo.PCMNumOfFrames - CurrentNumOfFrames) * NumChannels;
+		NumSamples = (PCMBufferInfo.PCMNumOfFrames - StartNumOfFrames) * NumChannels;
 	}
 
-	// Retrieving a part of PCM data
-	uint8* RetrievedPCMData = PCMBufferInfo.PCMData.GetView().GetData() + (CurrentNumOfFrames * NumChannels * sizeof(float));
 	const int32 RetrievedPCMDataSize = NumSamples * sizeof(float);
 
 	// Ensure we got a valid PCM data
-	if (RetrievedPCMDataSize <= 0 || RetrievedPCMData == nullptr)
+	if (RetrievedPCMDataSize <= 0 || PCMBufferInfo.PCMData.GetView().GetData() == nullptr)
 	{
 		return 0;
 	}
 
-	// Filling in OutAudio array with the retrieved PCM data
-	OutAudio = TArray<uint8>(RetrievedPCMData, RetrievedPCMDataSize);
+	// Filling in OutAudio array with a part of PCM data. Shrinking is not allowed, so no allocation happens once the array has grown to the callback size
+	OutAudio.SetNumUninitialized(RetrievedPCMDataSize, false);
+
+	float* GeneratedPCMDataPtr = reinterpret_cast<float*>(OutAudio.GetData());
+
+	// Silent spans are synthesized as zeros without reading the stored PCM data
+	const uint32 EndNumOfFrames = GenerateFrames(StartNumOfFrames, NumSamples / NumChannels, GeneratedPCMDataPtr);
+
+	// Applying the gain to the generated copy only, so the PCM buffer itself stays untouched
+	if (PlaybackGain != 1.f)
+	{
+		RuntimeAudioImporter_VectorMath::MultiplyByConstant(GeneratedPCMDataPtr, NumSamples, PlaybackGain);
+	}
 
 	// Increasing CurrentFrameCount for correct iteration sequence
-	CurrentNumOfFrames = CurrentNumOfFrames + (NumSamples / NumChannels);
+	PlaybackNumOfFrames.Store(EndNumOfFrames);
 
-	AsyncTask(ENamedThreads::GameThread, [this, RetrievedPCMData, RetrievedPCMDataSize = NumSamples]()
+	// Writing the generated data to the PCM tap for analysis consumers
+	if (bPCMTapEnabled)
 	{
-		if (OnGeneratePCMDataNative.IsBound())
-		{
-			OnGeneratePCMDataNative.Broadcast(TArray<float>(reinterpret_cast<float*>(RetrievedPCMData), RetrievedPCMDataSize));
-		}
-		
-		if (OnGeneratePCMData.IsBound())
+		PCMTapBuffer->Push(GeneratedPCMDataPtr, NumSamples, NumChannels);
+	}
+
+	// Broadcasting PCM data only if someone is listening. The data is copied once here since the PCM buffer may be released before the game thread task is executed
+	if (OnGeneratePCMDataNative.IsBound() || OnGeneratePCMData.IsBound())
+	{
+		TArray<float> GeneratedPCMData(GeneratedPCMDataPtr, NumSamples);
+
+		AsyncTask(ENamedThreads::GameThread, [this, GeneratedPCMData = MoveTemp(GeneratedPCMData)]()
 		{
-			OnGeneratePCMData.Broadcast(TArray<float>(reinterpret_cast<float*>(RetrievedPCMData), RetrievedPCMDataSize));
-		}
-	});
+			if (OnGeneratePCMDataNative.IsBound())
+			{
+				OnGeneratePCMDataNative.Broadcast(GeneratedPCMData);
+			}
+
+			if (OnGeneratePCMData.IsBound())
+			{
+				OnGeneratePCMData.Broadcast(GeneratedPCMData);
+			}
+		});
+	}
 
 	return NumSamples;
 }
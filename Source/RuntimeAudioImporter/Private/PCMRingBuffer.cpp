@@ -0,0 +1,88 @@
+// Georgy Treshchev 2022.
+
+#include "PCMRingBuffer.h"
+
+FPCMRingBuffer::FPCMRingBuffer(int32 InCapacity)
+	: ReadIndex(0)
+  , WriteIndex(0)
+  , NumOfDroppedSamples(0)
+{
+	Buffer.SetNumZeroed(static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 1)))));
+	Mask = static_cast<uint64>(Buffer.Num()) - 1;
+}
+
+int32 FPCMRingBuffer::Push(const float* Data, int32 NumOfSamples, int32 Granularity)
+{
+	// Only the producer modifies the write index, so it can be read relaxed. The read index is loaded with sequential consistency to see the consumer's progress
+	const uint64 CurrentWriteIndex = WriteIndex.Load(EMemoryOrder::Relaxed);
+	const uint64 CurrentReadIndex = ReadIndex.Load();
+
+	const int32 NumOfFreeSamples = Buffer.Num() - static_cast<int32>(CurrentWriteIndex - CurrentReadIndex);
+
+	int32 NumOfSamplesToPush = FMath::Min(NumOfSamples, NumOfFreeSamples);
+	NumOfSamplesToPush -= NumOfSamplesToPush % FMath::Max(Granularity, 1);
+
+	if (NumOfSamplesToPush < NumOfSamples)
+	{
+		NumOfDroppedSamples += NumOfSamples - NumOfSamplesToPush;
+	}
+
+	if (NumOfSamplesToPush <= 0)
+	{
+		return 0;
+	}
+
+	// Copying in at most two parts since the data may wrap around the end of the buffer
+	const int32 StartIndex = static_cast<int32>(CurrentWriteIndex & Mask);
+	const int32 NumOfSamplesBeforeWrap = FMath::Min(NumOfSamplesToPush, Buffer.Num() - StartIndex);
+
+	FMemory::Memcpy(Buffer.GetData() + StartIndex, Data, NumOfSamplesBeforeWrap * sizeof(float));
+	FMemory::Memcpy(Buffer.GetData(), Data + NumOfSamplesBeforeWrap, (NumOfSamplesToPush - NumOfSamplesBeforeWrap) * sizeof(float));
+
+	// Publishing the written samples to the consumer
+	WriteIndex.Store(CurrentWriteIndex + NumOfSamplesToPush);
+
+	return NumOfSamplesToPush;
+}
+
+int32 FPCMRingBuffer::Pop(float* OutData, int32 MaxNumOfSamples, int32 Granularity)
+{
+	const uint64 CurrentReadIndex = ReadIndex.Load(EMemoryOrder::Relaxed);
+	const uint64 CurrentWriteIndex = WriteIndex.Load();
+
+	int32 NumOfSamplesToPop = FMath::Min(MaxNumOfSamples, static_cast<int32>(CurrentWriteIndex - CurrentReadIndex));
+	NumOfSamplesToPop -= NumOfSamplesToPop % FMath::Max(Granularity, 1);
+
+	if (NumOfSamplesToPop <= 0)
+	{
+		return 0;
+	}
+
+	const int32 StartIndex = static_cast<int32>(CurrentReadIndex & Mask);
+	const int32 NumOfSamplesBeforeWrap = FMath::Min(NumOfSamplesToPop, Buffer.Num() - StartIndex);
+
+	FMemory::Memcpy(OutData, Buffer.GetData() + StartIndex, NumOfSamplesBeforeWrap * sizeof(float));
+	FMemory::Memcpy(OutData + NumOfSamplesBeforeWrap, Buffer.GetData(), (NumOfSamplesToPop - NumOfSamplesBeforeWrap) * sizeof(float));
+
+	// Releasing the read samples back to the producer
+	ReadIndex.Store(CurrentReadIndex + NumOfSamplesToPop);
+
+	return NumOfSamplesToPop;
+}
+
+int32 FPCMRingBuffer::Num() const
+{
+	// Loading the read index first, so that it can never be ahead of the loaded write index
+	const uint64 CurrentReadIndex = ReadIndex.Load();
+	return static_cast<int32>(WriteIndex.Load() - CurrentReadIndex);
+}
+
+int32 FPCMRingBuffer::GetCapacity() const
+{
+	return Buffer.Num();
+}
+
+uint64 FPCMRingBuffer::GetNumOfDroppedSamples() const
+{
+	return NumOfDroppedSamples.Load(EMemoryOrder::Relaxed);
+}
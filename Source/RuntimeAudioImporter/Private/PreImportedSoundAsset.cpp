@@ -1,6 +1,226 @@
 // Georgy Treshchev 2022.
 
 #include "PreImportedSoundAsset.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterLibrary.h"
+#include "Transcoders/RAWTranscoder.h"
 
+#include "Async/Async.h"
+#include "Serialization/CustomVersion.h"
 
+namespace
+{
+	/** Custom serialization version of the pre-imported sound asset */
+	struct FPreImportedSoundAssetVersion
+	{
+		enum Type
+		{
+			BeforeCustomVersionWasAdded = 0,
 
+			/** The audio data is stored in the bulk data instead of a property */
+			AudioDataInBulkData,
+
+			VersionPlusOne,
+			LatestVersion = VersionPlusOne - 1
+		};
+
+		static const FGuid GUID;
+	};
+
+	const FGuid FPreImportedSoundAssetVersion::GUID(0xE5CB814C, 0xE7C04235, 0x8E9B9C57, 0xE3E63F4F);
+
+	FCustomVersionRegistration GRegisterPreImportedSoundAssetVersion(FPreImportedSoundAssetVersion::GUID, FPreImportedSoundAssetVersion::LatestVersion, TEXT("PreImportedSoundAssetVer"));
+
+	/**
+	 * Replace the content of the bulk data. The payload is kept out of the export data, so that it is loaded only when requested
+	 */
+	void WriteBulkData(FByteBulkData& BulkData, const uint8* Data, int64 DataSize)
+	{
+		BulkData.Lock(LOCK_READ_WRITE);
+		FMemory::Memcpy(BulkData.Realloc(DataSize), Data, DataSize);
+		BulkData.Unlock();
+
+		BulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+	}
+}
+
+bool UPreImportedSoundAsset::HasPreDecodedAudioData() const
+{
+	return CookFormat != EPreImportedSoundCookFormat::Original && PreDecodedNumOfChannels > 0 && PreDecodedSampleRate > 0;
+}
+
+void UPreImportedSoundAsset::SetAudioData(const TArray<uint8>& AudioData)
+{
+	WriteBulkData(AudioBulkData, AudioData.GetData(), AudioData.Num());
+}
+
+void UPreImportedSoundAsset::LoadAudioDataAsync(TFunction<void(TArray<uint8> AudioData)> OnLoaded) const
+{
+	const FByteBulkData& BulkData{HasPreDecodedAudioData() ? PreDecodedBulkData : AudioBulkData};
+	const int64 BulkDataSize{BulkData.GetBulkDataSize()};
+
+	if (BulkDataSize > MAX_int32)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to load the audio data of the pre-imported sound asset '%s': the size '%lld' exceeds the limit"), *GetPathName(), BulkDataSize);
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [OnLoaded]()
+		{
+			OnLoaded(TArray<uint8>());
+		});
+		return;
+	}
+
+	// The audio data is already resident, e.g. in the editor right after the import
+	if (BulkDataSize <= 0 || BulkData.IsBulkDataLoaded())
+	{
+		TArray<uint8> AudioData;
+		if (BulkDataSize > 0)
+		{
+			AudioData.SetNumUninitialized(BulkDataSize);
+			FMemory::Memcpy(AudioData.GetData(), BulkData.LockReadOnly(), BulkDataSize);
+			BulkData.Unlock();
+		}
+
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [OnLoaded, AudioData = MoveTemp(AudioData)]() mutable
+		{
+			OnLoaded(MoveTemp(AudioData));
+		});
+		return;
+	}
+
+	TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> AudioData = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+	AudioData->SetNumUninitialized(BulkDataSize);
+
+	FBulkDataIORequestCallBack OnRequestCompleted = [AudioData, OnLoaded](bool bWasCancelled, IBulkDataIORequest* Request)
+	{
+		// The request cannot be deleted from its own callback
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [AudioData, OnLoaded, bWasCancelled, Request]()
+		{
+			Request->WaitCompletion(0.f);
+			delete Request;
+
+			OnLoaded(bWasCancelled ? TArray<uint8>() : MoveTemp(*AudioData));
+		});
+	};
+
+	// Streaming right into the array, so that the audio data is not copied once loaded
+	if (BulkData.CreateStreamingRequest(AIOP_Normal, &OnRequestCompleted, AudioData->GetData()) == nullptr)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to stream the audio data of the pre-imported sound asset '%s'"), *GetPathName());
+		AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [OnLoaded]()
+		{
+			OnLoaded(TArray<uint8>());
+		});
+	}
+}
+
+void UPreImportedSoundAsset::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar.UsingCustomVersion(FPreImportedSoundAssetVersion::GUID);
+
+	// The audio data of older packages is stored in a property and moved to the bulk data in PostLoad
+	if (Ar.IsLoading() && Ar.CustomVer(FPreImportedSoundAssetVersion::GUID) < FPreImportedSoundAssetVersion::AudioDataInBulkData)
+	{
+		return;
+	}
+
+	// Cooked packages contain either the pre-decoded audio data or the original audio data, not both
+	if (Ar.IsFilterEditorOnly() && HasPreDecodedAudioData())
+	{
+		PreDecodedBulkData.Serialize(Ar, this);
+	}
+	else
+	{
+		AudioBulkData.Serialize(Ar, this);
+	}
+}
+
+void UPreImportedSoundAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	if (AudioDataArray_DEPRECATED.Num() > 0)
+	{
+		SetAudioData(AudioDataArray_DEPRECATED);
+		AudioDataArray_DEPRECATED.Empty();
+
+#if WITH_EDITOR
+		// The migrated audio data is stored in the bulk data only once the package is resaved
+		MarkPackageDirty();
+#endif
+	}
+}
+
+#if WITH_EDITOR
+#if ENGINE_MAJOR_VERSION < 5
+void UPreImportedSoundAsset::PreSave(const ITargetPlatform* TargetPlatform)
+{
+	Super::PreSave(TargetPlatform);
+	const bool bIsCooking{TargetPlatform != nullptr};
+#else
+void UPreImportedSoundAsset::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+	const bool bIsCooking{SaveContext.IsCooking()};
+#endif
+
+	PreDecodedBulkData.RemoveBulkData();
+	PreDecodedNumOfChannels = 0;
+	PreDecodedSampleRate = 0;
+
+	// The pre-decoded audio data is stored in cooked packages only, the editor keeps importing the original audio data
+	if (!bIsCooking || CookFormat == EPreImportedSoundCookFormat::Original)
+	{
+		return;
+	}
+
+	const int64 AudioDataSize{AudioBulkData.GetBulkDataSize()};
+	if (AudioDataSize <= 0 || AudioDataSize > MAX_int32)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to pre-decode the audio data of the pre-imported sound asset '%s' of size '%lld', cooking the original audio data"), *GetPathName(), AudioDataSize);
+		return;
+	}
+
+	uint8* EncodedAudioDataPtr = static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(AudioDataSize), AudioBulkData.Lock(LOCK_READ_ONLY), AudioDataSize));
+	AudioBulkData.Unlock();
+
+	FEncodedAudioStruct EncodedAudioInfo(EncodedAudioDataPtr, AudioDataSize, AudioFormat);
+
+	FDecodedAudioStruct DecodedAudioInfo;
+	if (!URuntimeAudioImporterLibrary::DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo))
+	{
+		UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to pre-decode the audio data of the pre-imported sound asset '%s', cooking the original audio data"), *GetPathName());
+		return;
+	}
+
+	const TArrayView64<uint8> PCMData = DecodedAudioInfo.PCMInfo.PCMData.GetView();
+
+	switch (CookFormat)
+	{
+	case EPreImportedSoundCookFormat::Int16:
+		{
+			int16* Int16Data = nullptr;
+			int32 Int16DataSize = 0;
+
+			RAWTranscoder::TranscodeRAWData<float, int16>(reinterpret_cast<float*>(PCMData.GetData()), static_cast<int32>(PCMData.Num()), Int16Data, Int16DataSize);
+
+			WriteBulkData(PreDecodedBulkData, reinterpret_cast<uint8*>(Int16Data), Int16DataSize);
+			FMemory::Free(Int16Data);
+			break;
+		}
+	case EPreImportedSoundCookFormat::Float32:
+		{
+			WriteBulkData(PreDecodedBulkData, PCMData.GetData(), PCMData.Num());
+			break;
+		}
+	default:
+		break;
+	}
+
+	PreDecodedNumOfChannels = DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels;
+	PreDecodedSampleRate = DecodedAudioInfo.SoundWaveBasicInfo.SampleRate;
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Pre-decoded the audio data of the pre-imported sound asset '%s' from '%lld' to '%lld' bytes"), *GetPathName(), AudioDataSize, PreDecodedBulkData.GetBulkDataSize());
+}
+#endif
@@ -0,0 +1,165 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+/**
+ * Vectorized kernels shared by the audio processors. All functions accept unaligned pointers and handle the scalar tail
+ */
+namespace RuntimeAudioImporter_VectorMath
+{
+#if ENGINE_MAJOR_VERSION >= 5
+	using FFloatRegister = VectorRegister4Float;
+#else
+	using FFloatRegister = VectorRegister;
+#endif
+
+	/** Number of floats processed by a single vector register */
+	constexpr int32 FloatsPerRegister = 4;
+
+	/**
+	 * Sum all components of the vector register
+	 */
+	FORCEINLINE float HorizontalSum(const FFloatRegister& Register)
+	{
+		float Components[FloatsPerRegister];
+		VectorStore(Register, Components);
+		return (Components[0] + Components[1]) + (Components[2] + Components[3]);
+	}
+
+	/**
+	 * Calculate the dot product of two float arrays
+	 */
+	FORCEINLINE float DotProduct(const float* A, const float* B, int32 Num)
+	{
+		FFloatRegister Accumulator0 = VectorSetFloat1(0.f);
+		FFloatRegister Accumulator1 = VectorSetFloat1(0.f);
+
+		int32 Index = 0;
+		for (; Index + 2 * FloatsPerRegister <= Num; Index += 2 * FloatsPerRegister)
+		{
+			Accumulator0 = VectorMultiplyAdd(VectorLoad(A + Index), VectorLoad(B + Index), Accumulator0);
+			Accumulator1 = VectorMultiplyAdd(VectorLoad(A + Index + FloatsPerRegister), VectorLoad(B + Index + FloatsPerRegister), Accumulator1);
+		}
+
+		float Result = HorizontalSum(VectorAdd(Accumulator0, Accumulator1));
+
+		for (; Index < Num; ++Index)
+		{
+			Result += A[Index] * B[Index];
+		}
+
+		return Result;
+	}
+
+	/**
+	 * Multiply every element of the float array by the specified value
+	 */
+	FORCEINLINE void MultiplyByConstant(float* Data, int32 Num, float Multiplier)
+	{
+		const FFloatRegister MultiplierRegister = VectorSetFloat1(Multiplier);
+
+		int32 Index = 0;
+		for (; Index + FloatsPerRegister <= Num; Index += FloatsPerRegister)
+		{
+			VectorStore(VectorMultiply(VectorLoad(Data + Index), MultiplierRegister), Data + Index);
+		}
+
+		for (; Index < Num; ++Index)
+		{
+			Data[Index] *= Multiplier;
+		}
+	}
+
+	/**
+	 * Multiply two float arrays element by element
+	 */
+	FORCEINLINE void MultiplyArrays(const float* A, const float* B, float* Out, int32 Num)
+	{
+		int32 Index = 0;
+		for (; Index + FloatsPerRegister <= Num; Index += FloatsPerRegister)
+		{
+			VectorStore(VectorMultiply(VectorLoad(A + Index), VectorLoad(B + Index)), Out + Index);
+		}
+
+		for (; Index < Num; ++Index)
+		{
+			Out[Index] = A[Index] * B[Index];
+		}
+	}
+
+	/**
+	 * Calculate the minimum, the maximum and the sum of squares of a float array. The array must not be empty
+	 */
+	FORCEINLINE void GetMinMaxSumOfSquares(const float* Data, int32 Num, float& OutMin, float& OutMax, float& OutSumOfSquares)
+	{
+		int32 Index = 0;
+
+		float Min = Data[0];
+		float Max = Data[0];
+		float SumOfSquares = 0.f;
+
+		if (Num >= FloatsPerRegister)
+		{
+			FFloatRegister MinRegister = VectorLoad(Data);
+			FFloatRegister MaxRegister = MinRegister;
+			FFloatRegister SumOfSquaresRegister = VectorSetFloat1(0.f);
+
+			for (; Index + FloatsPerRegister <= Num; Index += FloatsPerRegister)
+			{
+				const FFloatRegister Samples = VectorLoad(Data + Index);
+				MinRegister = VectorMin(MinRegister, Samples);
+				MaxRegister = VectorMax(MaxRegister, Samples);
+				SumOfSquaresRegister = VectorMultiplyAdd(Samples, Samples, SumOfSquaresRegister);
+			}
+
+			float MinComponents[FloatsPerRegister];
+			float MaxComponents[FloatsPerRegister];
+			VectorStore(MinRegister, MinComponents);
+			VectorStore(MaxRegister, MaxComponents);
+
+			Min = FMath::Min(FMath::Min(MinComponents[0], MinComponents[1]), FMath::Min(MinComponents[2], MinComponents[3]));
+			Max = FMath::Max(FMath::Max(MaxComponents[0], MaxComponents[1]), FMath::Max(MaxComponents[2], MaxComponents[3]));
+			SumOfSquares = HorizontalSum(SumOfSquaresRegister);
+		}
+
+		for (; Index < Num; ++Index)
+		{
+			Min = FMath::Min(Min, Data[Index]);
+			Max = FMath::Max(Max, Data[Index]);
+			SumOfSquares += Data[Index] * Data[Index];
+		}
+
+		OutMin = Min;
+		OutMax = Max;
+		OutSumOfSquares = SumOfSquares;
+	}
+
+	/**
+	 * Get the maximum absolute value of a float array
+	 */
+	FORCEINLINE float GetMaxAbs(const float* Data, int32 Num)
+	{
+		FFloatRegister MaxRegister = VectorSetFloat1(0.f);
+
+		int32 Index = 0;
+		for (; Index + FloatsPerRegister <= Num; Index += FloatsPerRegister)
+		{
+			MaxRegister = VectorMax(MaxRegister, VectorAbs(VectorLoad(Data + Index)));
+		}
+
+		float MaxComponents[FloatsPerRegister];
+		VectorStore(MaxRegister, MaxComponents);
+
+		float Max = FMath::Max(FMath::Max(MaxComponents[0], MaxComponents[1]), FMath::Max(MaxComponents[2], MaxComponents[3]));
+
+		for (; Index < Num; ++Index)
+		{
+			Max = FMath::Max(Max, FMath::Abs(Data[Index]));
+		}
+
+		return Max;
+	}
+}
@@ -0,0 +1,249 @@
+// Georgy Treshchev 2022.
+
+#include "Processors/ChannelMixProcessor.h"
+#include "Processors/AudioVectorMath.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Number of frames processed by a single parallel task */
+	constexpr int32 FramesPerTask = 16384;
+
+	/** Gain of the center and surround channels when folding them into the front channels (-3 dB) */
+	constexpr float FoldDownGain = 0.707106781f;
+
+	/**
+	 * Mixing interleaved stereo frames into mono frames. Four frames are deinterleaved at a time with two shuffles
+	 */
+	void MixStereoToMono(const float* StereoData, float* MonoData, int32 NumOfFrames, float LeftGain, float RightGain)
+	{
+		using namespace RuntimeAudioImporter_VectorMath;
+
+		const FFloatRegister LeftGainRegister = VectorSetFloat1(LeftGain);
+		const FFloatRegister RightGainRegister = VectorSetFloat1(RightGain);
+
+		int32 FrameIndex = 0;
+		for (; FrameIndex + FloatsPerRegister <= NumOfFrames; FrameIndex += FloatsPerRegister)
+		{
+			const FFloatRegister FirstHalf = VectorLoad(StereoData + FrameIndex * 2);
+			const FFloatRegister SecondHalf = VectorLoad(StereoData + FrameIndex * 2 + FloatsPerRegister);
+
+			const FFloatRegister Left = VectorShuffle(FirstHalf, SecondHalf, 0, 2, 0, 2);
+			const FFloatRegister Right = VectorShuffle(FirstHalf, SecondHalf, 1, 3, 1, 3);
+
+			VectorStore(VectorMultiplyAdd(Left, LeftGainRegister, VectorMultiply(Right, RightGainRegister)), MonoData + FrameIndex);
+		}
+
+		for (; FrameIndex < NumOfFrames; ++FrameIndex)
+		{
+			MonoData[FrameIndex] = StereoData[FrameIndex * 2] * LeftGain + StereoData[FrameIndex * 2 + 1] * RightGain;
+		}
+	}
+}
+
+bool ChannelMixProcessor::Remix(FDecodedAudioStruct& DecodedData, EChannelRemixMode RemixMode, int32 ExtractedChannelIndex)
+{
+	const uint32 NumOfInputChannels = DecodedData.SoundWaveBasicInfo.NumOfChannels;
+
+	switch (RemixMode)
+	{
+	case EChannelRemixMode::None:
+		{
+			return true;
+		}
+	case EChannelRemixMode::DownmixToMono:
+		{
+			return NumOfInputChannels <= 1 || RemixWithMatrix(DecodedData, GetDownmixMatrix(NumOfInputChannels, 1), 1);
+		}
+	case EChannelRemixMode::DownmixToStereo:
+		{
+			return NumOfInputChannels <= 2 || RemixWithMatrix(DecodedData, GetDownmixMatrix(NumOfInputChannels, 2), 2);
+		}
+	case EChannelRemixMode::ExtractChannel:
+		{
+			if (ExtractedChannelIndex < 0 || static_cast<uint32>(ExtractedChannelIndex) >= NumOfInputChannels)
+			{
+				RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to extract channel '%d' because the audio data has '%d' channels"), ExtractedChannelIndex, NumOfInputChannels));
+				return false;
+			}
+
+			if (NumOfInputChannels == 1)
+			{
+				return true;
+			}
+
+			TArray<float> MixMatrix;
+			MixMatrix.SetNumZeroed(NumOfInputChannels);
+			MixMatrix[ExtractedChannelIndex] = 1.f;
+
+			return RemixWithMatrix(DecodedData, MixMatrix, 1);
+		}
+	default:
+		{
+			return false;
+		}
+	}
+}
+
+bool ChannelMixProcessor::RemixWithMatrix(FDecodedAudioStruct& DecodedData, const TArray<float>& MixMatrix, uint32 NumOfOutputChannels)
+{
+	const uint32 NumOfInputChannels = DecodedData.SoundWaveBasicInfo.NumOfChannels;
+	const int64 NumOfFrames = DecodedData.PCMInfo.PCMNumOfFrames;
+
+	if (NumOfInputChannels == 0 || NumOfOutputChannels == 0 || MixMatrix.Num() != static_cast<int32>(NumOfInputChannels * NumOfOutputChannels))
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to remix '%d' channels to '%d' channels with a mix matrix of size '%d'"), NumOfInputChannels, NumOfOutputChannels, MixMatrix.Num()));
+		return false;
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Remixing audio data from '%d' to '%d' channels.\nDecoded audio info: %s"), NumOfInputChannels, NumOfOutputChannels, *DecodedData.ToString()));
+
+	const int64 RemixedPCMDataSize = NumOfFrames * NumOfOutputChannels * sizeof(float);
+	float* RemixedData = static_cast<float*>(FMemory::Malloc(RemixedPCMDataSize));
+
+	if (RemixedData == nullptr)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(TEXT("Failed to allocate memory for remixed audio data"));
+		return false;
+	}
+
+	const float* SourceData = reinterpret_cast<const float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+	const int32 NumOfTasks = static_cast<int32>((NumOfFrames + FramesPerTask - 1) / FramesPerTask);
+
+	ParallelFor(NumOfTasks, [&](int32 TaskIndex)
+	{
+		const int64 FirstFrame = static_cast<int64>(TaskIndex) * FramesPerTask;
+		const int32 NumOfTaskFrames = static_cast<int32>(FMath::Min<int64>(FramesPerTask, NumOfFrames - FirstFrame));
+
+		const float* TaskSourceData = SourceData + FirstFrame * NumOfInputChannels;
+		float* TaskRemixedData = RemixedData + FirstFrame * NumOfOutputChannels;
+
+		// The most common case (stereo to mono) has a dedicated vectorized kernel
+		if (NumOfInputChannels == 2 && NumOfOutputChannels == 1)
+		{
+			MixStereoToMono(TaskSourceData, TaskRemixedData, NumOfTaskFrames, MixMatrix[0], MixMatrix[1]);
+			return;
+		}
+
+		for (int32 FrameIndex = 0; FrameIndex < NumOfTaskFrames; ++FrameIndex)
+		{
+			const float* InputFrame = TaskSourceData + FrameIndex * NumOfInputChannels;
+			float* OutputFrame = TaskRemixedData + FrameIndex * NumOfOutputChannels;
+
+			for (uint32 OutputChannelIndex = 0; OutputChannelIndex < NumOfOutputChannels; ++OutputChannelIndex)
+			{
+				const float* Gains = MixMatrix.GetData() + OutputChannelIndex * NumOfInputChannels;
+
+				float Sample = 0.f;
+				for (uint32 InputChannelIndex = 0; InputChannelIndex < NumOfInputChannels; ++InputChannelIndex)
+				{
+					Sample += InputFrame[InputChannelIndex] * Gains[InputChannelIndex];
+				}
+
+				OutputFrame[OutputChannelIndex] = Sample;
+			}
+		}
+	});
+
+	// Replacing the decoded data with the remixed one
+	{
+		DecodedData.PCMInfo.PCMData = FSharedPCMBuffer(reinterpret_cast<uint8*>(RemixedData), RemixedPCMDataSize);
+		DecodedData.SoundWaveBasicInfo.NumOfChannels = NumOfOutputChannels;
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Successfully remixed audio data.\nDecoded audio info: %s"), *DecodedData.ToString()));
+
+	return true;
+}
+
+TArray<float> ChannelMixProcessor::GetDownmixMatrix(uint32 NumOfInputChannels, uint32 NumOfOutputChannels)
+{
+	TArray<float> MixMatrix;
+	MixMatrix.SetNumZeroed(NumOfInputChannels * NumOfOutputChannels);
+
+	if (NumOfInputChannels == NumOfOutputChannels)
+	{
+		for (uint32 ChannelIndex = 0; ChannelIndex < NumOfInputChannels; ++ChannelIndex)
+		{
+			MixMatrix[ChannelIndex * NumOfInputChannels + ChannelIndex] = 1.f;
+		}
+
+		return MixMatrix;
+	}
+
+	if (NumOfOutputChannels > 2)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Downmixing to '%d' channels is not supported"), NumOfOutputChannels));
+		return TArray<float>();
+	}
+
+	// Building the stereo fold-down first. Channel order is FL, FR, FC, LFE, BL, BR, SL, SR. LFE is discarded
+	TArray<float> StereoMatrix;
+	StereoMatrix.SetNumZeroed(NumOfInputChannels * 2);
+	{
+		float* Left = StereoMatrix.GetData();
+		float* Right = StereoMatrix.GetData() + NumOfInputChannels;
+
+		switch (NumOfInputChannels)
+		{
+		case 1:
+			{
+				Left[0] = Right[0] = 1.f;
+				break;
+			}
+		case 3:
+		case 6:
+		case 8:
+			{
+				Left[0] = Right[1] = 1.f;
+				Left[2] = Right[2] = FoldDownGain;
+
+				for (uint32 SurroundIndex = 4; SurroundIndex + 1 < NumOfInputChannels; SurroundIndex += 2)
+				{
+					Left[SurroundIndex] = FoldDownGain;
+					Right[SurroundIndex + 1] = FoldDownGain;
+				}
+
+				// Normalizing to prevent clipping when all channels are at full scale
+				const float Normalization = 1.f / (1.f + FoldDownGain * (NumOfInputChannels == 3 ? 1 : (NumOfInputChannels - 2) / 2));
+				RuntimeAudioImporter_VectorMath::MultiplyByConstant(StereoMatrix.GetData(), StereoMatrix.Num(), Normalization);
+				break;
+			}
+		default:
+			{
+				// Unknown layouts: even channels go to the left, odd channels go to the right
+				const uint32 NumOfLeftChannels = (NumOfInputChannels + 1) / 2;
+				const uint32 NumOfRightChannels = FMath::Max<uint32>(NumOfInputChannels / 2, 1);
+
+				for (uint32 ChannelIndex = 0; ChannelIndex < NumOfInputChannels; ++ChannelIndex)
+				{
+					if (ChannelIndex % 2 == 0)
+					{
+						Left[ChannelIndex] = 1.f / NumOfLeftChannels;
+					}
+					else
+					{
+						Right[ChannelIndex] = 1.f / NumOfRightChannels;
+					}
+				}
+				break;
+			}
+		}
+	}
+
+	if (NumOfOutputChannels == 2)
+	{
+		return StereoMatrix;
+	}
+
+	// Mono is the average of the stereo fold-down
+	for (uint32 ChannelIndex = 0; ChannelIndex < NumOfInputChannels; ++ChannelIndex)
+	{
+		MixMatrix[ChannelIndex] = NumOfInputChannels == 1 ? 1.f : 0.5f * (StereoMatrix[ChannelIndex] + StereoMatrix[NumOfInputChannels + ChannelIndex]);
+	}
+
+	return MixMatrix;
+}
@@ -0,0 +1,37 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDecodedAudioStruct;
+enum class EChannelRemixMode : uint8;
+
+class RUNTIMEAUDIOIMPORTER_API ChannelMixProcessor
+{
+public:
+	/**
+	 * Convert the channel layout of decoded audio data using one of the predefined remix modes
+	 *
+	 * @param DecodedData Decoded audio data to be remixed in place
+	 * @param RemixMode How to convert the channels
+	 * @param ExtractedChannelIndex Index of the channel to keep when extracting a single channel
+	 * @return Whether the remixing was successful or not
+	 */
+	static bool Remix(FDecodedAudioStruct& DecodedData, EChannelRemixMode RemixMode, int32 ExtractedChannelIndex);
+
+	/**
+	 * Convert the channel layout of decoded audio data using a custom mix matrix
+	 *
+	 * @param DecodedData Decoded audio data to be remixed in place
+	 * @param MixMatrix Row-major gains, one row of input channel gains per output channel
+	 * @param NumOfOutputChannels The required number of channels
+	 * @return Whether the remixing was successful or not
+	 */
+	static bool RemixWithMatrix(FDecodedAudioStruct& DecodedData, const TArray<float>& MixMatrix, uint32 NumOfOutputChannels);
+
+	/**
+	 * Build a downmix matrix for the specified number of input and output channels, assuming the standard WAV channel order
+	 */
+	static TArray<float> GetDownmixMatrix(uint32 NumOfInputChannels, uint32 NumOfOutputChannels);
+};
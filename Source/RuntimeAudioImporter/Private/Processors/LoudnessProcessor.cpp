@@ -0,0 +1,358 @@
+// Georgy Treshchev 2022.
+
+#include "Processors/LoudnessProcessor.h"
+#include "Processors/AudioVectorMath.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Duration of a gating step, in seconds. Gating blocks consist of four steps (400 ms with 75% overlap) */
+	constexpr double StepDuration = 0.1;
+
+	/** Number of gating steps per gating block */
+	constexpr int32 StepsPerBlock = 4;
+
+	/** Number of gating steps processed by a single parallel true peak task */
+	constexpr int32 StepsPerTask = 50;
+
+	/** Absolute gating threshold, in LUFS */
+	constexpr double AbsoluteGateThreshold = -70;
+
+	/** Relative gating threshold, in LU below the absolute-gated loudness */
+	constexpr double RelativeGateThreshold = -10;
+
+	/** Level reported for digital silence, in decibels */
+	constexpr double SilenceLevel = -200;
+
+	/** Oversampling factor of the true peak measurement */
+	constexpr int32 OversamplingFactor = 4;
+
+	/** Number of taps per phase of the true peak oversampling filter */
+	constexpr int32 TruePeakTapsPerPhase = 12;
+
+	/** Second-order IIR filter section with double precision state */
+	struct FBiquad
+	{
+		double B0, B1, B2, A1, A2;
+		double X1 = 0, X2 = 0, Y1 = 0, Y2 = 0;
+
+		double Process(double Input)
+		{
+			const double Output = B0 * Input + B1 * X1 + B2 * X2 - A1 * Y1 - A2 * Y2;
+			X2 = X1;
+			X1 = Input;
+			Y2 = Y1;
+			Y1 = Output;
+			return Output;
+		}
+	};
+
+	/**
+	 * Get the K-weighting filters (high shelf followed by high pass) for the specified sample rate, matching the BS.1770 coefficients at 48 kHz
+	 */
+	void GetKWeightingFilters(uint32 SampleRate, FBiquad& Shelf, FBiquad& HighPass)
+	{
+		{
+			constexpr double CenterFrequency = 1681.974450955533;
+			constexpr double GainDecibels = 3.999843853973347;
+			constexpr double Q = 0.7071752369554196;
+
+			const double K = FMath::Tan(PI * CenterFrequency / SampleRate);
+			const double Vh = FMath::Pow(10., GainDecibels / 20.);
+			const double Vb = FMath::Pow(Vh, 0.4996667741545416);
+			const double A0 = 1 + K / Q + K * K;
+
+			Shelf.B0 = (Vh + Vb * K / Q + K * K) / A0;
+			Shelf.B1 = 2 * (K * K - Vh) / A0;
+			Shelf.B2 = (Vh - Vb * K / Q + K * K) / A0;
+			Shelf.A1 = 2 * (K * K - 1) / A0;
+			Shelf.A2 = (1 - K / Q + K * K) / A0;
+		}
+
+		{
+			constexpr double CutoffFrequency = 38.13547087602444;
+			constexpr double Q = 0.5003270373238773;
+
+			const double K = FMath::Tan(PI * CutoffFrequency / SampleRate);
+			const double A0 = 1 + K / Q + K * K;
+
+			HighPass.B0 = 1;
+			HighPass.B1 = -2;
+			HighPass.B2 = 1;
+			HighPass.A1 = 2 * (K * K - 1) / A0;
+			HighPass.A2 = (1 - K / Q + K * K) / A0;
+		}
+	}
+
+	/**
+	 * Get the BS.1770 weight of the channel. Channel order is FL, FR, FC, LFE, BL, BR, SL, SR
+	 */
+	double GetChannelWeight(int32 ChannelIndex, int32 NumOfChannels)
+	{
+		if (NumOfChannels == 6 || NumOfChannels == 8)
+		{
+			if (ChannelIndex == 3)
+			{
+				return 0;
+			}
+
+			if (ChannelIndex >= 4)
+			{
+				return 1.41;
+			}
+		}
+
+		return 1;
+	}
+
+	/**
+	 * Get the polyphase oversampling filter of the true peak measurement. Taps of each phase are stored in reverse order so that they can be applied with a dot product over the input history
+	 */
+	TArray<float> GetTruePeakFilter()
+	{
+		constexpr int32 NumOfTaps = OversamplingFactor * TruePeakTapsPerPhase;
+		constexpr double Center = (NumOfTaps - 1) / 2.;
+
+		TArray<float> Filter;
+		Filter.SetNumUninitialized(NumOfTaps);
+
+		for (int32 PhaseIndex = 0; PhaseIndex < OversamplingFactor; ++PhaseIndex)
+		{
+			float* PhaseTaps = Filter.GetData() + PhaseIndex * TruePeakTapsPerPhase;
+			double PhaseSum = 0;
+
+			for (int32 TapIndex = 0; TapIndex < TruePeakTapsPerPhase; ++TapIndex)
+			{
+				const int32 FilterIndex = (TruePeakTapsPerPhase - 1 - TapIndex) * OversamplingFactor + PhaseIndex;
+
+				// Blackman-windowed sinc with the cutoff at the original Nyquist frequency
+				const double Time = (FilterIndex - Center) / OversamplingFactor;
+				const double Sinc = FMath::IsNearlyZero(Time) ? 1. : FMath::Sin(PI * Time) / (PI * Time);
+				const double Window = 0.42 - 0.5 * FMath::Cos(2 * PI * FilterIndex / (NumOfTaps - 1)) + 0.08 * FMath::Cos(4 * PI * FilterIndex / (NumOfTaps - 1));
+
+				PhaseTaps[TapIndex] = static_cast<float>(Sinc * Window);
+				PhaseSum += PhaseTaps[TapIndex];
+			}
+
+			// Normalizing each phase to unity DC gain
+			RuntimeAudioImporter_VectorMath::MultiplyByConstant(PhaseTaps, TruePeakTapsPerPhase, static_cast<float>(1. / PhaseSum));
+		}
+
+		return Filter;
+	}
+
+	double EnergyToLoudness(double Energy)
+	{
+		return Energy > 0 ? -0.691 + 10 * FMath::LogX(10., Energy) : SilenceLevel;
+	}
+
+	double LinearToDecibels(double Value)
+	{
+		return Value > 0 ? 20 * FMath::LogX(10., Value) : SilenceLevel;
+	}
+}
+
+bool LoudnessProcessor::Analyze(const FDecodedAudioStruct& DecodedData, float TargetLoudness, float MaxTruePeak, FLoudnessInfo& LoudnessInfo)
+{
+	const int64 NumOfFrames = DecodedData.PCMInfo.PCMNumOfFrames;
+	const int32 NumOfChannels = static_cast<int32>(DecodedData.SoundWaveBasicInfo.NumOfChannels);
+	const uint32 SampleRate = DecodedData.SoundWaveBasicInfo.SampleRate;
+
+	if (NumOfChannels <= 0 || SampleRate == 0 || NumOfFrames == 0)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to analyze the loudness of audio data.\nDecoded audio info: %s"), *DecodedData.ToString()));
+		return false;
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Analyzing loudness of audio data.\nDecoded audio info: %s"), *DecodedData.ToString()));
+
+	const int64 FramesPerStep = FMath::Max<int64>(FMath::RoundToInt(SampleRate * StepDuration), 1);
+	const int64 FramesPerTask = FramesPerStep * StepsPerTask;
+
+	// The last step may be partial. It is only used if the audio data is shorter than a gating block
+	const int32 NumOfSteps = static_cast<int32>((NumOfFrames + FramesPerStep - 1) / FramesPerStep);
+	const int32 NumOfTasks = static_cast<int32>((NumOfFrames + FramesPerTask - 1) / FramesPerTask);
+
+	const float* PCMData = reinterpret_cast<const float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+	const TArray<float> TruePeakFilter{GetTruePeakFilter()};
+
+	FBiquad ShelfFilter, HighPassFilter;
+	GetKWeightingFilters(SampleRate, ShelfFilter, HighPassFilter);
+
+	// K-weighted energy of each step of each channel
+	TArray<double> StepEnergies;
+	StepEnergies.SetNumZeroed(NumOfSteps * NumOfChannels);
+
+	TArray<float> TaskTruePeaks;
+	TaskTruePeaks.SetNumZeroed(NumOfTasks * NumOfChannels);
+
+	// The K-weighting filters are recursive, so each channel is filtered from start to end by a single task
+	ParallelFor(NumOfChannels, [&](int32 ChannelIndex)
+	{
+		FBiquad ChannelShelfFilter{ShelfFilter};
+		FBiquad ChannelHighPassFilter{HighPassFilter};
+
+		double StepEnergy = 0;
+		for (int64 FrameIndex = 0; FrameIndex < NumOfFrames; ++FrameIndex)
+		{
+			const double Filtered = ChannelHighPassFilter.Process(ChannelShelfFilter.Process(PCMData[FrameIndex * NumOfChannels + ChannelIndex]));
+			StepEnergy += Filtered * Filtered;
+
+			if ((FrameIndex + 1) % FramesPerStep == 0 || FrameIndex + 1 == NumOfFrames)
+			{
+				StepEnergies[static_cast<int32>(FrameIndex / FramesPerStep) * NumOfChannels + ChannelIndex] = StepEnergy;
+				StepEnergy = 0;
+			}
+		}
+	});
+
+	// The oversampling filter only looks back a few samples, so the true peak is measured in parallel over chunks of each channel
+	ParallelFor(NumOfTasks * NumOfChannels, [&](int32 TaskIndex)
+	{
+		const int32 ChannelIndex = TaskIndex / NumOfTasks;
+		const int64 FirstFrame = (TaskIndex % NumOfTasks) * FramesPerTask;
+		const int64 EndFrame = FMath::Min(FirstFrame + FramesPerTask, NumOfFrames);
+		const int64 HistoryFrame = FMath::Max<int64>(FirstFrame - (TruePeakTapsPerPhase - 1), 0);
+
+		// Deinterleaving the chunk along with the preceding samples used as the filter history. The history is zero at the very beginning
+		TArray<float> ChannelData;
+		ChannelData.SetNumZeroed(static_cast<int32>(TruePeakTapsPerPhase - 1 + EndFrame - FirstFrame));
+
+		float* ChannelSamples = ChannelData.GetData() + TruePeakTapsPerPhase - 1;
+		for (int64 FrameIndex = HistoryFrame; FrameIndex < EndFrame; ++FrameIndex)
+		{
+			ChannelSamples[FrameIndex - FirstFrame] = PCMData[FrameIndex * NumOfChannels + ChannelIndex];
+		}
+
+		// Measuring the true peak on the 4x oversampled signal. The original samples are included as well since no phase reproduces them exactly
+		float TruePeak = 0;
+		for (int64 FrameIndex = FirstFrame; FrameIndex < EndFrame; ++FrameIndex)
+		{
+			const float* History = ChannelSamples + (FrameIndex - FirstFrame) - (TruePeakTapsPerPhase - 1);
+
+			TruePeak = FMath::Max(TruePeak, FMath::Abs(History[TruePeakTapsPerPhase - 1]));
+
+			for (int32 PhaseIndex = 0; PhaseIndex < OversamplingFactor; ++PhaseIndex)
+			{
+				TruePeak = FMath::Max(TruePeak, FMath::Abs(RuntimeAudioImporter_VectorMath::DotProduct(TruePeakFilter.GetData() + PhaseIndex * TruePeakTapsPerPhase, History, TruePeakTapsPerPhase)));
+			}
+		}
+
+		TaskTruePeaks[TaskIndex] = TruePeak;
+	});
+
+	// Calculating the weighted energy of each gating block
+	TArray<double> BlockEnergies;
+	{
+		const int32 NumOfFullSteps = static_cast<int32>(NumOfFrames / FramesPerStep);
+
+		auto GetWeightedEnergy = [&](int32 FirstStep, int32 NumOfBlockSteps, int64 NumOfBlockFrames)
+		{
+			double Energy = 0;
+
+			for (int32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+			{
+				double ChannelEnergy = 0;
+
+				for (int32 StepIndex = FirstStep; StepIndex < FirstStep + NumOfBlockSteps; ++StepIndex)
+				{
+					ChannelEnergy += StepEnergies[StepIndex * NumOfChannels + ChannelIndex];
+				}
+
+				Energy += GetChannelWeight(ChannelIndex, NumOfChannels) * ChannelEnergy / NumOfBlockFrames;
+			}
+
+			return Energy;
+		};
+
+		if (NumOfFullSteps >= StepsPerBlock)
+		{
+			BlockEnergies.SetNumUninitialized(NumOfFullSteps - StepsPerBlock + 1);
+
+			for (int32 BlockIndex = 0; BlockIndex < BlockEnergies.Num(); ++BlockIndex)
+			{
+				BlockEnergies[BlockIndex] = GetWeightedEnergy(BlockIndex, StepsPerBlock, StepsPerBlock * FramesPerStep);
+			}
+		}
+		else
+		{
+			// Audio data shorter than a gating block is measured as a single block
+			BlockEnergies.Add(GetWeightedEnergy(0, NumOfSteps, NumOfFrames));
+		}
+	}
+
+	// Applying the absolute and then the relative gate
+	double IntegratedLoudness = SilenceLevel;
+	{
+		auto GetGatedMeanEnergy = [&BlockEnergies](double Threshold)
+		{
+			double EnergySum = 0;
+			int32 NumOfGatedBlocks = 0;
+
+			for (const double BlockEnergy : BlockEnergies)
+			{
+				if (EnergyToLoudness(BlockEnergy) > Threshold)
+				{
+					EnergySum += BlockEnergy;
+					++NumOfGatedBlocks;
+				}
+			}
+
+			return NumOfGatedBlocks > 0 ? EnergySum / NumOfGatedBlocks : 0.;
+		};
+
+		const double AbsoluteGatedEnergy = GetGatedMeanEnergy(AbsoluteGateThreshold);
+
+		if (AbsoluteGatedEnergy > 0)
+		{
+			// Blocks must pass both gates, so the relative gate never drops below the absolute one
+			const double RelativeGate = EnergyToLoudness(AbsoluteGatedEnergy) + RelativeGateThreshold;
+			IntegratedLoudness = EnergyToLoudness(GetGatedMeanEnergy(FMath::Max(AbsoluteGateThreshold, RelativeGate)));
+		}
+	}
+
+	float TruePeak = 0;
+	for (const float TaskTruePeak : TaskTruePeaks)
+	{
+		TruePeak = FMath::Max(TruePeak, TaskTruePeak);
+	}
+
+	LoudnessInfo.IntegratedLoudness = static_cast<float>(IntegratedLoudness);
+	LoudnessInfo.TruePeak = static_cast<float>(LinearToDecibels(TruePeak));
+
+	// Silent audio data is left untouched
+	if (IntegratedLoudness > AbsoluteGateThreshold)
+	{
+		const double GainDecibels = FMath::Min<double>(TargetLoudness - IntegratedLoudness, MaxTruePeak - LoudnessInfo.TruePeak);
+		LoudnessInfo.NormalizationGain = static_cast<float>(FMath::Pow(10., GainDecibels / 20.));
+	}
+	else
+	{
+		LoudnessInfo.NormalizationGain = 1.f;
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Successfully analyzed loudness of audio data.\nLoudness info: %s"), *LoudnessInfo.ToString()));
+
+	return true;
+}
+
+void LoudnessProcessor::ApplyGain(FDecodedAudioStruct& DecodedData, float Gain)
+{
+	constexpr int64 SamplesPerTask = 65536;
+
+	// The PCM data may be shared with other sound waves, in which case it is copied before being modified
+	DecodedData.PCMInfo.PCMData.Detach();
+
+	float* PCMData = reinterpret_cast<float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+	const int64 NumOfSamples = static_cast<int64>(DecodedData.PCMInfo.PCMNumOfFrames) * DecodedData.SoundWaveBasicInfo.NumOfChannels;
+	const int32 NumOfTasks = static_cast<int32>((NumOfSamples + SamplesPerTask - 1) / SamplesPerTask);
+
+	ParallelFor(NumOfTasks, [&](int32 TaskIndex)
+	{
+		const int64 FirstSample = TaskIndex * SamplesPerTask;
+		RuntimeAudioImporter_VectorMath::MultiplyByConstant(PCMData + FirstSample, static_cast<int32>(FMath::Min(SamplesPerTask, NumOfSamples - FirstSample)), Gain);
+	});
+}
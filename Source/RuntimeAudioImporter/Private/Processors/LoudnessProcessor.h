@@ -0,0 +1,31 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDecodedAudioStruct;
+struct FLoudnessInfo;
+
+class RUNTIMEAUDIOIMPORTER_API LoudnessProcessor
+{
+public:
+	/**
+	 * Measure the integrated loudness (ITU-R BS.1770 / EBU R128) and the true peak of decoded audio data and calculate the gain normalizing it to the target loudness
+	 *
+	 * @param DecodedData Decoded audio data to analyze
+	 * @param TargetLoudness Loudness to normalize to, in LUFS
+	 * @param MaxTruePeak Maximum true peak after normalization, in dBTP. Limits the normalization gain
+	 * @param LoudnessInfo The measured loudness
+	 * @return Whether the analysis was successful or not
+	 */
+	static bool Analyze(const FDecodedAudioStruct& DecodedData, float TargetLoudness, float MaxTruePeak, FLoudnessInfo& LoudnessInfo);
+
+	/**
+	 * Multiply decoded audio data by the specified gain
+	 *
+	 * @param DecodedData Decoded audio data to modify
+	 * @param Gain Linear gain
+	 */
+	static void ApplyGain(FDecodedAudioStruct& DecodedData, float Gain);
+};
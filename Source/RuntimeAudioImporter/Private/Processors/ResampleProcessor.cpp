@@ -0,0 +1,206 @@
+// Georgy Treshchev 2022.
+
+#include "Processors/ResampleProcessor.h"
+#include "Processors/AudioVectorMath.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Maximum number of polyphase branches. Ratios requiring more branches use the nearest branch */
+	constexpr uint32 MaxNumOfPhases = 1024;
+
+	/** Maximum number of taps per branch, limits the filter length when strongly downsampling */
+	constexpr int32 MaxNumOfTaps = 512;
+
+	/** Number of output frames processed by a single parallel task */
+	constexpr int32 FramesPerTask = 8192;
+
+	/**
+	 * Zeroth order modified Bessel function of the first kind, used by the Kaiser window
+	 */
+	double BesselI0(double Value)
+	{
+		double Sum = 1., Term = 1.;
+		const double HalfValueSquared = Value * Value / 4.;
+
+		for (int32 Index = 1; Index < 64 && Term > Sum * 1e-12; ++Index)
+		{
+			Term *= HalfValueSquared / (static_cast<double>(Index) * Index);
+			Sum += Term;
+		}
+
+		return Sum;
+	}
+
+	/**
+	 * Euclidean algorithm for reducing the resampling ratio
+	 */
+	uint32 GetGreatestCommonDivisor(uint32 A, uint32 B)
+	{
+		while (B != 0)
+		{
+			const uint32 Remainder = A % B;
+			A = B;
+			B = Remainder;
+		}
+
+		return A;
+	}
+
+	/**
+	 * Getting the base number of taps and the Kaiser window beta for the specified quality
+	 */
+	TTuple<int32, double> GetFilterParameters(EAudioResamplingQuality Quality)
+	{
+		switch (Quality)
+		{
+		case EAudioResamplingQuality::Low:
+			return TTuple<int32, double>(16, 6.);
+		case EAudioResamplingQuality::High:
+			return TTuple<int32, double>(64, 10.);
+		case EAudioResamplingQuality::Medium:
+		default:
+			return TTuple<int32, double>(32, 8.6);
+		}
+	}
+}
+
+bool ResampleProcessor::Resample(FDecodedAudioStruct& DecodedData, uint32 TargetSampleRate, EAudioResamplingQuality Quality)
+{
+	const uint32 SourceSampleRate = DecodedData.SoundWaveBasicInfo.SampleRate;
+	const int32 NumOfChannels = static_cast<int32>(DecodedData.SoundWaveBasicInfo.NumOfChannels);
+	const int64 NumOfSourceFrames = DecodedData.PCMInfo.PCMNumOfFrames;
+
+	if (SourceSampleRate == TargetSampleRate)
+	{
+		return true;
+	}
+
+	if (SourceSampleRate == 0 || TargetSampleRate == 0 || NumOfChannels <= 0)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to resample audio data from '%d' to '%d' sample rate with '%d' channels"), SourceSampleRate, TargetSampleRate, NumOfChannels));
+		return false;
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Resampling audio data from '%d' to '%d' sample rate.\nDecoded audio info: %s"), SourceSampleRate, TargetSampleRate, *DecodedData.ToString()));
+
+	// Reducing the ratio so that output frame N maps to input position N * Decimation / Interpolation
+	const uint32 GreatestCommonDivisor = GetGreatestCommonDivisor(SourceSampleRate, TargetSampleRate);
+	const int64 Interpolation = TargetSampleRate / GreatestCommonDivisor;
+	const int64 Decimation = SourceSampleRate / GreatestCommonDivisor;
+	const int64 NumOfPhases = FMath::Min<int64>(Interpolation, MaxNumOfPhases);
+
+	// Widening the filter when downsampling to keep the cutoff below the new Nyquist frequency
+	const TTuple<int32, double> FilterParameters{GetFilterParameters(Quality)};
+	const double DownsamplingRatio = FMath::Max(1., static_cast<double>(SourceSampleRate) / TargetSampleRate);
+	const int32 NumOfTaps = FMath::Min(Align(FMath::CeilToInt(FilterParameters.Get<0>() * DownsamplingRatio), RuntimeAudioImporter_VectorMath::FloatsPerRegister), MaxNumOfTaps);
+	const int32 HalfNumOfTaps = NumOfTaps / 2;
+	const double Cutoff = 0.5 * 0.95 / DownsamplingRatio;
+	const double WindowNormalization = BesselI0(FilterParameters.Get<1>());
+
+	// Building the polyphase filter bank. Each branch is normalized to unity gain at DC
+	TArray<float> FilterBank;
+	FilterBank.SetNumUninitialized(static_cast<int32>(NumOfPhases * NumOfTaps));
+
+	for (int64 PhaseIndex = 0; PhaseIndex < NumOfPhases; ++PhaseIndex)
+	{
+		float* Branch = FilterBank.GetData() + PhaseIndex * NumOfTaps;
+		const double Fraction = static_cast<double>(PhaseIndex) / NumOfPhases;
+		double BranchSum = 0.;
+
+		for (int32 TapIndex = 0; TapIndex < NumOfTaps; ++TapIndex)
+		{
+			const double Distance = (TapIndex - (HalfNumOfTaps - 1)) - Fraction;
+			const double SincArgument = 2. * Cutoff * Distance;
+			const double Sinc = FMath::IsNearlyZero(SincArgument) ? 1. : FMath::Sin(PI * SincArgument) / (PI * SincArgument);
+
+			const double WindowPosition = Distance / HalfNumOfTaps;
+			const double Window = FMath::Abs(WindowPosition) >= 1. ? 0. : BesselI0(FilterParameters.Get<1>() * FMath::Sqrt(1. - WindowPosition * WindowPosition)) / WindowNormalization;
+
+			const double Coefficient = 2. * Cutoff * Sinc * Window;
+			Branch[TapIndex] = static_cast<float>(Coefficient);
+			BranchSum += Coefficient;
+		}
+
+		if (!FMath::IsNearlyZero(BranchSum))
+		{
+			for (int32 TapIndex = 0; TapIndex < NumOfTaps; ++TapIndex)
+			{
+				Branch[TapIndex] = static_cast<float>(Branch[TapIndex] / BranchSum);
+			}
+		}
+	}
+
+	// Deinterleaving into zero-padded planar buffers so that each output sample is a contiguous dot product
+	const int64 PaddedNumOfFrames = NumOfSourceFrames + NumOfTaps;
+	TArray<float> PlanarData;
+	PlanarData.SetNumZeroed(static_cast<int32>(PaddedNumOfFrames * NumOfChannels));
+
+	const float* SourceData = reinterpret_cast<const float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+
+	for (int32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+	{
+		float* ChannelData = PlanarData.GetData() + ChannelIndex * PaddedNumOfFrames + HalfNumOfTaps;
+
+		for (int64 FrameIndex = 0; FrameIndex < NumOfSourceFrames; ++FrameIndex)
+		{
+			ChannelData[FrameIndex] = SourceData[FrameIndex * NumOfChannels + ChannelIndex];
+		}
+	}
+
+	const int64 NumOfTargetFrames = (NumOfSourceFrames * Interpolation + Decimation - 1) / Decimation;
+	const int64 TargetPCMDataSize = NumOfTargetFrames * NumOfChannels * sizeof(float);
+
+	float* TargetData = static_cast<float*>(FMemory::Malloc(TargetPCMDataSize));
+
+	if (TargetData == nullptr)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(TEXT("Failed to allocate memory for resampled audio data"));
+		return false;
+	}
+
+	const int32 NumOfTasksPerChannel = static_cast<int32>((NumOfTargetFrames + FramesPerTask - 1) / FramesPerTask);
+
+	ParallelFor(NumOfTasksPerChannel * NumOfChannels, [&](int32 TaskIndex)
+	{
+		const int32 ChannelIndex = TaskIndex / NumOfTasksPerChannel;
+		const int64 FirstFrame = static_cast<int64>(TaskIndex % NumOfTasksPerChannel) * FramesPerTask;
+		const int64 LastFrame = FMath::Min<int64>(FirstFrame + FramesPerTask, NumOfTargetFrames);
+
+		const float* ChannelData = PlanarData.GetData() + ChannelIndex * PaddedNumOfFrames;
+
+		for (int64 FrameIndex = FirstFrame; FrameIndex < LastFrame; ++FrameIndex)
+		{
+			// The first tap of the window is located (HalfNumOfTaps - 1) frames before the source position, which is shifted by HalfNumOfTaps due to padding
+			const int64 Position = FrameIndex * Decimation;
+			const int64 SourceFrame = Position / Interpolation;
+			const int64 PhaseIndex = (Position % Interpolation) * NumOfPhases / Interpolation;
+
+			TargetData[FrameIndex * NumOfChannels + ChannelIndex] = RuntimeAudioImporter_VectorMath::DotProduct(FilterBank.GetData() + PhaseIndex * NumOfTaps, ChannelData + SourceFrame + 1, NumOfTaps);
+		}
+	});
+
+	// Replacing the decoded data with the resampled one
+	{
+		DecodedData.PCMInfo.PCMData = FSharedPCMBuffer(reinterpret_cast<uint8*>(TargetData), TargetPCMDataSize);
+		DecodedData.PCMInfo.PCMNumOfFrames = static_cast<uint32>(NumOfTargetFrames);
+
+		// Moving the loop points to the nearest frames of the new timeline
+		if (DecodedData.LoopRegion.IsSet() && NumOfTargetFrames > 0)
+		{
+			FLoopRegionStruct& LoopRegion = DecodedData.LoopRegion.GetValue();
+			LoopRegion.StartFrame = static_cast<uint32>(FMath::Min<int64>((LoopRegion.StartFrame * Interpolation + Decimation / 2) / Decimation, NumOfTargetFrames - 1));
+			LoopRegion.EndFrame = static_cast<uint32>(FMath::Clamp<int64>((LoopRegion.EndFrame * Interpolation + Decimation / 2) / Decimation, LoopRegion.StartFrame + 1, NumOfTargetFrames));
+		}
+
+		DecodedData.SoundWaveBasicInfo.SampleRate = TargetSampleRate;
+		DecodedData.SoundWaveBasicInfo.Duration = static_cast<float>(NumOfTargetFrames) / TargetSampleRate;
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Successfully resampled audio data.\nDecoded audio info: %s"), *DecodedData.ToString()));
+
+	return true;
+}
@@ -0,0 +1,22 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDecodedAudioStruct;
+enum class EAudioResamplingQuality : uint8;
+
+class RUNTIMEAUDIOIMPORTER_API ResampleProcessor
+{
+public:
+	/**
+	 * Convert decoded audio data to the specified sample rate using a polyphase windowed-sinc filter
+	 *
+	 * @param DecodedData Decoded audio data to be resampled in place
+	 * @param TargetSampleRate The required number of samples per second
+	 * @param Quality Quality of the resampling filter
+	 * @return Whether the resampling was successful or not
+	 */
+	static bool Resample(FDecodedAudioStruct& DecodedData, uint32 TargetSampleRate, EAudioResamplingQuality Quality);
+};
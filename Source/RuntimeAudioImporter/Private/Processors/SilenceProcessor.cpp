@@ -0,0 +1,351 @@
+// Georgy Treshchev 2022.
+
+#include "Processors/SilenceProcessor.h"
+#include "Processors/AudioVectorMath.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Number of frames classified as silent or not at once */
+	constexpr uint32 FramesPerBlock = 128;
+
+	/** Number of blocks classified by a single parallel task */
+	constexpr int32 BlocksPerTask = 256;
+
+	/**
+	 * Check whether all samples of the frame are below the threshold
+	 */
+	bool IsFrameSilent(const float* Frame, uint32 NumOfChannels, float Threshold)
+	{
+		return RuntimeAudioImporter_VectorMath::GetMaxAbs(Frame, NumOfChannels) <= Threshold;
+	}
+
+	/**
+	 * Get the number of silent frames preceding the stored frames located before the specified span
+	 */
+	uint32 GetNumOfSilentFramesBefore(const TArray<FPCMSilentSpan>& SilentSpans, int32 SpanIndex)
+	{
+		if (SpanIndex <= 0)
+		{
+			return 0;
+		}
+
+		const FPCMSilentSpan& PreviousSpan = SilentSpans[SpanIndex - 1];
+		return PreviousSpan.StartFrame + PreviousSpan.NumOfFrames - PreviousSpan.StoredFrame;
+	}
+
+	/**
+	 * Get the index of the first stored frame at or after the specified frame of the playback timeline
+	 */
+	uint32 GetStoredFrame(const TArray<FPCMSilentSpan>& SilentSpans, uint32 Frame)
+	{
+		// Finding the first span that ends after the frame
+		const int32 SpanIndex = Algo::UpperBoundBy(SilentSpans, Frame, [](const FPCMSilentSpan& SilentSpan)
+		{
+			return SilentSpan.StartFrame + SilentSpan.NumOfFrames;
+		});
+
+		if (SpanIndex < SilentSpans.Num() && Frame >= SilentSpans[SpanIndex].StartFrame)
+		{
+			return SilentSpans[SpanIndex].StoredFrame;
+		}
+
+		return Frame - GetNumOfSilentFramesBefore(SilentSpans, SpanIndex);
+	}
+}
+
+bool SilenceProcessor::TrimEdges(FDecodedAudioStruct& DecodedData, float ThresholdDecibels)
+{
+	const uint32 NumOfChannels = DecodedData.SoundWaveBasicInfo.NumOfChannels;
+	const uint32 NumOfFrames = DecodedData.PCMInfo.PCMNumOfFrames;
+
+	if (NumOfChannels == 0 || DecodedData.PCMInfo.SilentSpans.Num() > 0)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to trim silence of audio data.\nDecoded audio info: %s"), *DecodedData.ToString()));
+		return false;
+	}
+
+	const float Threshold = FMath::Pow(10.f, ThresholdDecibels / 20.f);
+	const float* PCMData = reinterpret_cast<const float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+
+	// Scanning whole blocks from the start with vectorized reductions, then refining the first loud block frame by frame
+	uint32 FirstFrame = NumOfFrames;
+	for (uint32 BlockFrame = 0; BlockFrame < NumOfFrames; BlockFrame += FramesPerBlock)
+	{
+		const uint32 NumOfBlockFrames = FMath::Min(FramesPerBlock, NumOfFrames - BlockFrame);
+
+		if (RuntimeAudioImporter_VectorMath::GetMaxAbs(PCMData + BlockFrame * NumOfChannels, NumOfBlockFrames * NumOfChannels) > Threshold)
+		{
+			FirstFrame = BlockFrame;
+			while (IsFrameSilent(PCMData + FirstFrame * NumOfChannels, NumOfChannels, Threshold))
+			{
+				++FirstFrame;
+			}
+			break;
+		}
+	}
+
+	if (FirstFrame == NumOfFrames)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintLog(TEXT("Audio data is silent as a whole, so it will not be trimmed"));
+		return true;
+	}
+
+	// Same from the end. There is at least one loud frame, so the scan stops before reaching the first frame
+	uint32 EndFrame = FirstFrame + 1;
+	for (uint32 BlockEndFrame = NumOfFrames; BlockEndFrame > FirstFrame; BlockEndFrame -= FMath::Min(FramesPerBlock, BlockEndFrame))
+	{
+		const uint32 NumOfBlockFrames = FMath::Min(FramesPerBlock, BlockEndFrame);
+
+		if (RuntimeAudioImporter_VectorMath::GetMaxAbs(PCMData + (BlockEndFrame - NumOfBlockFrames) * NumOfChannels, NumOfBlockFrames * NumOfChannels) > Threshold)
+		{
+			EndFrame = BlockEndFrame;
+			while (IsFrameSilent(PCMData + (EndFrame - 1) * NumOfChannels, NumOfChannels, Threshold))
+			{
+				--EndFrame;
+			}
+			break;
+		}
+	}
+
+	if (FirstFrame == 0 && EndFrame == NumOfFrames)
+	{
+		return true;
+	}
+
+	const uint32 NumOfTrimmedFrames = EndFrame - FirstFrame;
+	const int64 TrimmedPCMDataSize = static_cast<int64>(NumOfTrimmedFrames) * NumOfChannels * sizeof(float);
+	float* TrimmedPCMData = static_cast<float*>(FMemory::Malloc(TrimmedPCMDataSize));
+
+	if (TrimmedPCMData == nullptr)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(TEXT("Failed to allocate memory for trimmed audio data"));
+		return false;
+	}
+
+	FMemory::Memcpy(TrimmedPCMData, PCMData + static_cast<int64>(FirstFrame) * NumOfChannels, TrimmedPCMDataSize);
+
+	// Replacing the decoded data with the trimmed one
+	{
+		DecodedData.PCMInfo.PCMData = FSharedPCMBuffer(reinterpret_cast<uint8*>(TrimmedPCMData), TrimmedPCMDataSize);
+		DecodedData.PCMInfo.PCMNumOfFrames = NumOfTrimmedFrames;
+		DecodedData.SoundWaveBasicInfo.Duration = static_cast<float>(NumOfTrimmedFrames) / DecodedData.SoundWaveBasicInfo.SampleRate;
+
+		// Shifting the loop points to the trimmed timeline. A loop lying entirely within the trimmed silence is dropped
+		if (DecodedData.LoopRegion.IsSet())
+		{
+			const uint32 LoopStartFrame = FMath::Clamp(DecodedData.LoopRegion->StartFrame, FirstFrame, EndFrame) - FirstFrame;
+			const uint32 LoopEndFrame = FMath::Clamp(DecodedData.LoopRegion->EndFrame, FirstFrame, EndFrame) - FirstFrame;
+
+			if (LoopEndFrame > LoopStartFrame)
+			{
+				DecodedData.LoopRegion = FLoopRegionStruct{LoopStartFrame, LoopEndFrame};
+			}
+			else
+			{
+				DecodedData.LoopRegion.Reset();
+			}
+		}
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Successfully trimmed '%d' leading and '%d' trailing silent frames.\nDecoded audio info: %s"), FirstFrame, NumOfFrames - EndFrame, *DecodedData.ToString()));
+
+	return true;
+}
+
+bool SilenceProcessor::CompactSilence(FDecodedAudioStruct& DecodedData, float ThresholdDecibels, float MinSilenceDuration)
+{
+	const uint32 NumOfChannels = DecodedData.SoundWaveBasicInfo.NumOfChannels;
+	const uint32 NumOfFrames = DecodedData.PCMInfo.PCMNumOfFrames;
+
+	if (NumOfChannels == 0 || DecodedData.PCMInfo.SilentSpans.Num() > 0)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to compact silence of audio data.\nDecoded audio info: %s"), *DecodedData.ToString()));
+		return false;
+	}
+
+	const float Threshold = FMath::Pow(10.f, ThresholdDecibels / 20.f);
+	const uint32 MinNumOfSilentBlocks = FMath::Max<uint32>(FMath::CeilToInt(MinSilenceDuration * DecodedData.SoundWaveBasicInfo.SampleRate / FramesPerBlock), 1);
+	const float* PCMData = reinterpret_cast<const float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+
+	// Classifying whole blocks in parallel. The partial block at the end is always stored
+	const int32 NumOfBlocks = static_cast<int32>(NumOfFrames / FramesPerBlock);
+
+	TArray<bool> SilentBlocks;
+	SilentBlocks.SetNumUninitialized(NumOfBlocks);
+
+	ParallelFor((NumOfBlocks + BlocksPerTask - 1) / BlocksPerTask, [&](int32 TaskIndex)
+	{
+		const int32 EndBlockIndex = FMath::Min((TaskIndex + 1) * BlocksPerTask, NumOfBlocks);
+
+		for (int32 BlockIndex = TaskIndex * BlocksPerTask; BlockIndex < EndBlockIndex; ++BlockIndex)
+		{
+			SilentBlocks[BlockIndex] = RuntimeAudioImporter_VectorMath::GetMaxAbs(PCMData + static_cast<int64>(BlockIndex) * FramesPerBlock * NumOfChannels, FramesPerBlock * NumOfChannels) <= Threshold;
+		}
+	});
+
+	// Collecting long enough runs of silent blocks
+	TArray<FPCMSilentSpan> SilentSpans;
+	uint32 NumOfSilentFrames = 0;
+
+	for (int32 BlockIndex = 0; BlockIndex < NumOfBlocks;)
+	{
+		if (!SilentBlocks[BlockIndex])
+		{
+			++BlockIndex;
+			continue;
+		}
+
+		const int32 FirstBlockIndex = BlockIndex;
+		while (BlockIndex < NumOfBlocks && SilentBlocks[BlockIndex])
+		{
+			++BlockIndex;
+		}
+
+		const uint32 NumOfRunBlocks = BlockIndex - FirstBlockIndex;
+		if (NumOfRunBlocks >= MinNumOfSilentBlocks)
+		{
+			FPCMSilentSpan& SilentSpan = SilentSpans.AddDefaulted_GetRef();
+			SilentSpan.StartFrame = FirstBlockIndex * FramesPerBlock;
+			SilentSpan.NumOfFrames = NumOfRunBlocks * FramesPerBlock;
+			SilentSpan.StoredFrame = SilentSpan.StartFrame - NumOfSilentFrames;
+
+			NumOfSilentFrames += SilentSpan.NumOfFrames;
+		}
+	}
+
+	if (SilentSpans.Num() == 0)
+	{
+		return true;
+	}
+
+	const int64 CompactedPCMDataSize = static_cast<int64>(NumOfFrames - NumOfSilentFrames) * NumOfChannels * sizeof(float);
+	float* CompactedPCMData = static_cast<float*>(FMemory::Malloc(FMath::Max<int64>(CompactedPCMDataSize, sizeof(float))));
+
+	if (CompactedPCMData == nullptr)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(TEXT("Failed to allocate memory for compacted audio data"));
+		return false;
+	}
+
+	// Copying the frames between the silent spans
+	{
+		uint32 SourceFrame = 0;
+
+		for (int32 SpanIndex = 0; SpanIndex <= SilentSpans.Num(); ++SpanIndex)
+		{
+			const uint32 SegmentEndFrame = SpanIndex < SilentSpans.Num() ? SilentSpans[SpanIndex].StartFrame : NumOfFrames;
+			const uint32 StoredFrame = SourceFrame - GetNumOfSilentFramesBefore(SilentSpans, SpanIndex);
+
+			FMemory::Memcpy(CompactedPCMData + static_cast<int64>(StoredFrame) * NumOfChannels, PCMData + static_cast<int64>(SourceFrame) * NumOfChannels, static_cast<int64>(SegmentEndFrame - SourceFrame) * NumOfChannels * sizeof(float));
+
+			if (SpanIndex < SilentSpans.Num())
+			{
+				SourceFrame = SilentSpans[SpanIndex].StartFrame + SilentSpans[SpanIndex].NumOfFrames;
+			}
+		}
+	}
+
+	// Replacing the decoded data with the compacted one. The number of frames and the duration stay the same
+	{
+		DecodedData.PCMInfo.PCMData = FSharedPCMBuffer(reinterpret_cast<uint8*>(CompactedPCMData), CompactedPCMDataSize);
+		DecodedData.PCMInfo.SilentSpans = MoveTemp(SilentSpans);
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Successfully removed '%d' silent frames from the stored audio data.\nDecoded audio info: %s"), NumOfSilentFrames, *DecodedData.ToString()));
+
+	return true;
+}
+
+void SilenceProcessor::CopyFrames(const FPCMStruct& PCMInfo, uint32 NumOfChannels, uint32 StartFrame, uint32 NumOfFrames, float* OutData)
+{
+	const float* StoredData = reinterpret_cast<const float*>(PCMInfo.PCMData.GetView().GetData());
+	const TArray<FPCMSilentSpan>& SilentSpans = PCMInfo.SilentSpans;
+
+	if (SilentSpans.Num() == 0)
+	{
+		FMemory::Memcpy(OutData, StoredData + static_cast<int64>(StartFrame) * NumOfChannels, static_cast<int64>(NumOfFrames) * NumOfChannels * sizeof(float));
+		return;
+	}
+
+	// Finding the first span that ends after the start frame
+	int32 SpanIndex = Algo::UpperBoundBy(SilentSpans, StartFrame, [](const FPCMSilentSpan& SilentSpan)
+	{
+		return SilentSpan.StartFrame + SilentSpan.NumOfFrames;
+	});
+
+	const uint32 EndFrame = StartFrame + NumOfFrames;
+	uint32 CurrentFrame = StartFrame;
+
+	while (CurrentFrame < EndFrame)
+	{
+		const int64 OutOffset = static_cast<int64>(CurrentFrame - StartFrame) * NumOfChannels;
+
+		// Synthesizing zeros for the frames inside the silent span
+		if (SpanIndex < SilentSpans.Num() && CurrentFrame >= SilentSpans[SpanIndex].StartFrame)
+		{
+			const uint32 SilentEndFrame = FMath::Min(EndFrame, SilentSpans[SpanIndex].StartFrame + SilentSpans[SpanIndex].NumOfFrames);
+			FMemory::Memzero(OutData + OutOffset, static_cast<int64>(SilentEndFrame - CurrentFrame) * NumOfChannels * sizeof(float));
+
+			CurrentFrame = SilentEndFrame;
+			++SpanIndex;
+			continue;
+		}
+
+		// Copying the stored frames until the next silent span
+		const uint32 StoredEndFrame = SpanIndex < SilentSpans.Num() ? FMath::Min(EndFrame, SilentSpans[SpanIndex].StartFrame) : EndFrame;
+		const uint32 StoredFrame = CurrentFrame - GetNumOfSilentFramesBefore(SilentSpans, SpanIndex);
+		FMemory::Memcpy(OutData + OutOffset, StoredData + static_cast<int64>(StoredFrame) * NumOfChannels, static_cast<int64>(StoredEndFrame - CurrentFrame) * NumOfChannels * sizeof(float));
+
+		CurrentFrame = StoredEndFrame;
+	}
+}
+
+FPCMStruct SilenceProcessor::Expand(const FPCMStruct& PCMInfo, uint32 NumOfChannels)
+{
+	if (PCMInfo.SilentSpans.Num() == 0)
+	{
+		return PCMInfo;
+	}
+
+	const int64 ExpandedPCMDataSize = static_cast<int64>(PCMInfo.PCMNumOfFrames) * NumOfChannels * sizeof(float);
+	float* ExpandedPCMData = static_cast<float*>(FMemory::Malloc(ExpandedPCMDataSize));
+
+	CopyFrames(PCMInfo, NumOfChannels, 0, PCMInfo.PCMNumOfFrames, ExpandedPCMData);
+
+	FPCMStruct ExpandedPCMInfo;
+	ExpandedPCMInfo.PCMData = FSharedPCMBuffer(reinterpret_cast<uint8*>(ExpandedPCMData), ExpandedPCMDataSize);
+	ExpandedPCMInfo.PCMNumOfFrames = PCMInfo.PCMNumOfFrames;
+
+	return ExpandedPCMInfo;
+}
+
+FPCMStruct SilenceProcessor::Slice(const FPCMStruct& PCMInfo, uint32 NumOfChannels, uint32 StartFrame, uint32 NumOfFrames)
+{
+	const uint32 EndFrame = StartFrame + NumOfFrames;
+	const uint32 StoredStartFrame = GetStoredFrame(PCMInfo.SilentSpans, StartFrame);
+	const uint32 StoredEndFrame = GetStoredFrame(PCMInfo.SilentSpans, EndFrame);
+	const int64 FrameSize = static_cast<int64>(NumOfChannels) * sizeof(float);
+
+	FPCMStruct SlicedPCMInfo;
+	SlicedPCMInfo.PCMData = PCMInfo.PCMData.Slice(StoredStartFrame * FrameSize, (StoredEndFrame - StoredStartFrame) * FrameSize);
+	SlicedPCMInfo.PCMNumOfFrames = NumOfFrames;
+
+	// Clipping the silent spans overlapping the sub-range and moving them to its timeline
+	for (const FPCMSilentSpan& SilentSpan : PCMInfo.SilentSpans)
+	{
+		const uint32 SpanStartFrame = FMath::Max(SilentSpan.StartFrame, StartFrame);
+		const uint32 SpanEndFrame = FMath::Min(SilentSpan.StartFrame + SilentSpan.NumOfFrames, EndFrame);
+
+		if (SpanStartFrame < SpanEndFrame)
+		{
+			SlicedPCMInfo.SilentSpans.Add(FPCMSilentSpan{SpanStartFrame - StartFrame, SpanEndFrame - SpanStartFrame, SilentSpan.StoredFrame - StoredStartFrame});
+		}
+	}
+
+	return SlicedPCMInfo;
+}
@@ -0,0 +1,62 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDecodedAudioStruct;
+struct FPCMStruct;
+
+class RUNTIMEAUDIOIMPORTER_API SilenceProcessor
+{
+public:
+	/**
+	 * Remove the leading and trailing silence of decoded audio data. Audio data that is silent as a whole is left untouched
+	 *
+	 * @param DecodedData Decoded audio data to trim
+	 * @param ThresholdDecibels Level below which the audio is considered silent, in dBFS
+	 * @return Whether the trimming was successful or not
+	 */
+	static bool TrimEdges(FDecodedAudioStruct& DecodedData, float ThresholdDecibels);
+
+	/**
+	 * Remove long internal silence from the stored PCM data, replacing it with silent spans. The playback timeline stays the same
+	 *
+	 * @param DecodedData Decoded audio data to compact
+	 * @param ThresholdDecibels Level below which the audio is considered silent, in dBFS
+	 * @param MinSilenceDuration Minimum duration of the silence to be removed, in seconds
+	 * @return Whether the compaction was successful or not
+	 */
+	static bool CompactSilence(FDecodedAudioStruct& DecodedData, float ThresholdDecibels, float MinSilenceDuration);
+
+	/**
+	 * Copy frames of the playback timeline, synthesizing zeros for the silent spans without touching the stored PCM data
+	 *
+	 * @param PCMInfo PCM data to copy from
+	 * @param NumOfChannels Number of channels
+	 * @param StartFrame First frame to copy
+	 * @param NumOfFrames Number of frames to copy. The range must lie within the PCM data
+	 * @param OutData Pointer to the memory with room for at least NumOfFrames * NumOfChannels samples
+	 */
+	static void CopyFrames(const FPCMStruct& PCMInfo, uint32 NumOfChannels, uint32 StartFrame, uint32 NumOfFrames, float* OutData);
+
+	/**
+	 * Get a copy of the PCM data with the silent spans expanded to zeros, e.g. for encoding
+	 *
+	 * @param PCMInfo PCM data to expand
+	 * @param NumOfChannels Number of channels
+	 * @return PCM data without silent spans
+	 */
+	static FPCMStruct Expand(const FPCMStruct& PCMInfo, uint32 NumOfChannels);
+
+	/**
+	 * Get PCM data viewing a sub-range of the playback timeline. The stored PCM data is shared, not copied
+	 *
+	 * @param PCMInfo PCM data to slice
+	 * @param NumOfChannels Number of channels
+	 * @param StartFrame First frame of the sub-range
+	 * @param NumOfFrames Number of frames in the sub-range. The range must lie within the PCM data
+	 * @return PCM data of the sub-range
+	 */
+	static FPCMStruct Slice(const FPCMStruct& PCMInfo, uint32 NumOfChannels, uint32 StartFrame, uint32 NumOfFrames);
+};
@@ -0,0 +1,276 @@
+// Georgy Treshchev 2022.
+
+#include "Processors/SpectrogramProcessor.h"
+#include "Processors/AudioVectorMath.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Number of FFT frames processed by a single parallel task */
+	constexpr int32 FramesPerTask = 32;
+
+	/** Supported range of FFT sizes */
+	constexpr uint32 MinFFTSize = 64;
+	constexpr uint32 MaxFFTSize = 16384;
+
+	/**
+	 * Radix-2 FFT of real input, computed through a complex FFT of half the size
+	 * Real and imaginary parts are kept in separate arrays so that the butterflies can be vectorized
+	 */
+	class FRealFFT
+	{
+	public:
+		explicit FRealFFT(int32 InFFTSize)
+			: FFTSize(InFFTSize)
+		  , HalfSize(InFFTSize / 2)
+		{
+			// Bit-reversal permutation of the half-size complex FFT
+			{
+				BitReversedIndices.SetNumUninitialized(HalfSize);
+
+				const int32 NumOfBits = FMath::FloorLog2(HalfSize);
+				for (int32 Index = 0; Index < HalfSize; ++Index)
+				{
+					int32 ReversedIndex = 0;
+					for (int32 BitIndex = 0; BitIndex < NumOfBits; ++BitIndex)
+					{
+						ReversedIndex |= ((Index >> BitIndex) & 1) << (NumOfBits - 1 - BitIndex);
+					}
+
+					BitReversedIndices[Index] = ReversedIndex;
+				}
+			}
+
+			// Twiddles of the butterfly stages, stored contiguously per stage starting at index (HalfStageSize - 1)
+			{
+				StageTwiddlesReal.SetNumUninitialized(HalfSize);
+				StageTwiddlesImag.SetNumUninitialized(HalfSize);
+
+				for (int32 HalfStageSize = 1; HalfStageSize < HalfSize; HalfStageSize <<= 1)
+				{
+					for (int32 Index = 0; Index < HalfStageSize; ++Index)
+					{
+						const double Angle = -PI * Index / HalfStageSize;
+						StageTwiddlesReal[HalfStageSize - 1 + Index] = static_cast<float>(FMath::Cos(Angle));
+						StageTwiddlesImag[HalfStageSize - 1 + Index] = static_cast<float>(FMath::Sin(Angle));
+					}
+				}
+			}
+
+			// Twiddles splitting the half-size spectrum into the spectrum of the real input
+			{
+				SplitTwiddlesReal.SetNumUninitialized(HalfSize + 1);
+				SplitTwiddlesImag.SetNumUninitialized(HalfSize + 1);
+
+				for (int32 Bin = 0; Bin <= HalfSize; ++Bin)
+				{
+					const double Angle = -2. * PI * Bin / FFTSize;
+					SplitTwiddlesReal[Bin] = static_cast<float>(FMath::Cos(Angle));
+					SplitTwiddlesImag[Bin] = static_cast<float>(FMath::Sin(Angle));
+				}
+			}
+		}
+
+		/**
+		 * Compute the magnitudes of FFTSize real samples
+		 *
+		 * @param Input FFTSize real samples
+		 * @param Real Scratch memory of HalfSize floats
+		 * @param Imag Scratch memory of HalfSize floats
+		 * @param Magnitudes Output memory of (HalfSize + 1) floats
+		 * @param Scale Multiplier applied to the magnitudes
+		 */
+		void ComputeMagnitudes(const float* Input, float* Real, float* Imag, float* Magnitudes, float Scale) const
+		{
+			using namespace RuntimeAudioImporter_VectorMath;
+
+			// Packing even samples as real parts and odd samples as imaginary parts, in bit-reversed order
+			for (int32 Index = 0; Index < HalfSize; ++Index)
+			{
+				const int32 TargetIndex = BitReversedIndices[Index];
+				Real[TargetIndex] = Input[2 * Index];
+				Imag[TargetIndex] = Input[2 * Index + 1];
+			}
+
+			for (int32 HalfStageSize = 1; HalfStageSize < HalfSize; HalfStageSize <<= 1)
+			{
+				const float* TwiddlesReal = StageTwiddlesReal.GetData() + HalfStageSize - 1;
+				const float* TwiddlesImag = StageTwiddlesImag.GetData() + HalfStageSize - 1;
+
+				for (int32 GroupStart = 0; GroupStart < HalfSize; GroupStart += 2 * HalfStageSize)
+				{
+					float* TopReal = Real + GroupStart;
+					float* TopImag = Imag + GroupStart;
+					float* BottomReal = TopReal + HalfStageSize;
+					float* BottomImag = TopImag + HalfStageSize;
+
+					int32 Index = 0;
+
+					// Stages with at least four butterflies per group are processed four butterflies at a time
+					for (; Index + FloatsPerRegister <= HalfStageSize; Index += FloatsPerRegister)
+					{
+						const FFloatRegister TwiddleReal = VectorLoad(TwiddlesReal + Index);
+						const FFloatRegister TwiddleImag = VectorLoad(TwiddlesImag + Index);
+						const FFloatRegister BottomRealValue = VectorLoad(BottomReal + Index);
+						const FFloatRegister BottomImagValue = VectorLoad(BottomImag + Index);
+
+						const FFloatRegister ProductReal = VectorSubtract(VectorMultiply(BottomRealValue, TwiddleReal), VectorMultiply(BottomImagValue, TwiddleImag));
+						const FFloatRegister ProductImag = VectorMultiplyAdd(BottomRealValue, TwiddleImag, VectorMultiply(BottomImagValue, TwiddleReal));
+
+						const FFloatRegister TopRealValue = VectorLoad(TopReal + Index);
+						const FFloatRegister TopImagValue = VectorLoad(TopImag + Index);
+
+						VectorStore(VectorSubtract(TopRealValue, ProductReal), BottomReal + Index);
+						VectorStore(VectorSubtract(TopImagValue, ProductImag), BottomImag + Index);
+						VectorStore(VectorAdd(TopRealValue, ProductReal), TopReal + Index);
+						VectorStore(VectorAdd(TopImagValue, ProductImag), TopImag + Index);
+					}
+
+					for (; Index < HalfStageSize; ++Index)
+					{
+						const float ProductReal = BottomReal[Index] * TwiddlesReal[Index] - BottomImag[Index] * TwiddlesImag[Index];
+						const float ProductImag = BottomReal[Index] * TwiddlesImag[Index] + BottomImag[Index] * TwiddlesReal[Index];
+
+						BottomReal[Index] = TopReal[Index] - ProductReal;
+						BottomImag[Index] = TopImag[Index] - ProductImag;
+						TopReal[Index] += ProductReal;
+						TopImag[Index] += ProductImag;
+					}
+				}
+			}
+
+			// Splitting the spectrum Z of the packed sequence into the spectrum X of the real input:
+			// X[k] = (Z[k] + conj(Z[N/2 - k])) / 2 + W^k * (Z[k] - conj(Z[N/2 - k])) / 2i
+			for (int32 Bin = 0; Bin <= HalfSize; ++Bin)
+			{
+				const int32 Index = Bin % HalfSize;
+				const int32 MirroredIndex = (HalfSize - Bin) % HalfSize;
+
+				const float EvenReal = 0.5f * (Real[Index] + Real[MirroredIndex]);
+				const float EvenImag = 0.5f * (Imag[Index] - Imag[MirroredIndex]);
+				const float OddReal = 0.5f * (Imag[Index] + Imag[MirroredIndex]);
+				const float OddImag = -0.5f * (Real[Index] - Real[MirroredIndex]);
+
+				const float BinReal = EvenReal + SplitTwiddlesReal[Bin] * OddReal - SplitTwiddlesImag[Bin] * OddImag;
+				const float BinImag = EvenImag + SplitTwiddlesReal[Bin] * OddImag + SplitTwiddlesImag[Bin] * OddReal;
+
+				Magnitudes[Bin] = Scale * FMath::Sqrt(BinReal * BinReal + BinImag * BinImag);
+			}
+		}
+
+		/** Number of real input samples */
+		const int32 FFTSize;
+
+		/** Size of the complex FFT */
+		const int32 HalfSize;
+
+	private:
+		TArray<int32> BitReversedIndices;
+		TArray<float> StageTwiddlesReal;
+		TArray<float> StageTwiddlesImag;
+		TArray<float> SplitTwiddlesReal;
+		TArray<float> SplitTwiddlesImag;
+	};
+}
+
+bool SpectrogramProcessor::Generate(const FDecodedAudioStruct& DecodedData, uint32 FFTSize, uint32 HopSize, FSpectrogramStruct& Spectrogram)
+{
+	const int64 NumOfSourceFrames = DecodedData.PCMInfo.PCMNumOfFrames;
+	const int32 NumOfChannels = static_cast<int32>(DecodedData.SoundWaveBasicInfo.NumOfChannels);
+
+	if (!FMath::IsPowerOfTwo(FFTSize) || FFTSize < MinFFTSize || FFTSize > MaxFFTSize || HopSize == 0 || NumOfChannels <= 0)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to generate a spectrogram with FFT size '%d' (must be a power of two from %d to %d) and hop size '%d'"), FFTSize, MinFFTSize, MaxFFTSize, HopSize));
+		return false;
+	}
+
+	// The last frame is zero-padded so that the whole audio data is covered
+	const int64 NumOfFrames = NumOfSourceFrames <= FFTSize ? 1 : 1 + (NumOfSourceFrames - FFTSize + HopSize - 1) / HopSize;
+	const int32 NumOfBins = FFTSize / 2 + 1;
+
+	if (NumOfFrames * NumOfBins > MAX_int32)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to generate a spectrogram with '%lld' frames. Increase the hop size"), NumOfFrames));
+		return false;
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Generating spectrogram with FFT size '%d' and hop size '%d'.\nDecoded audio info: %s"), FFTSize, HopSize, *DecodedData.ToString()));
+
+	Spectrogram.FFTSize = FFTSize;
+	Spectrogram.HopSize = HopSize;
+	Spectrogram.NumOfBins = NumOfBins;
+	Spectrogram.NumOfFrames = static_cast<uint32>(NumOfFrames);
+	Spectrogram.SampleRate = DecodedData.SoundWaveBasicInfo.SampleRate;
+	Spectrogram.Magnitudes.SetNumUninitialized(static_cast<int32>(NumOfFrames * NumOfBins));
+
+	const FRealFFT FFT(FFTSize);
+
+	// Periodic Hann window. Magnitudes are scaled so that a full-scale sine has a peak magnitude of 1
+	TArray<float> Window;
+	Window.SetNumUninitialized(FFTSize);
+
+	double WindowSum = 0.;
+	for (uint32 Index = 0; Index < FFTSize; ++Index)
+	{
+		Window[Index] = static_cast<float>(0.5 - 0.5 * FMath::Cos(2. * PI * Index / FFTSize));
+		WindowSum += Window[Index];
+	}
+
+	const float Scale = static_cast<float>(2. / WindowSum);
+
+	const float* SourceData = reinterpret_cast<const float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+	const int32 NumOfTasks = static_cast<int32>((NumOfFrames + FramesPerTask - 1) / FramesPerTask);
+
+	ParallelFor(NumOfTasks, [&](int32 TaskIndex)
+	{
+		TArray<float> FrameData, Real, Imag;
+		FrameData.SetNumUninitialized(FFT.FFTSize);
+		Real.SetNumUninitialized(FFT.HalfSize);
+		Imag.SetNumUninitialized(FFT.HalfSize);
+
+		const int64 FirstFrame = static_cast<int64>(TaskIndex) * FramesPerTask;
+		const int64 LastFrame = FMath::Min<int64>(FirstFrame + FramesPerTask, NumOfFrames);
+
+		for (int64 FrameIndex = FirstFrame; FrameIndex < LastFrame; ++FrameIndex)
+		{
+			const int64 FrameStart = FrameIndex * HopSize;
+			const int32 NumOfAvailableSamples = static_cast<int32>(FMath::Clamp<int64>(NumOfSourceFrames - FrameStart, 0, FFTSize));
+
+			// Mixing the channels down to mono
+			if (NumOfChannels == 1)
+			{
+				FMemory::Memcpy(FrameData.GetData(), SourceData + FrameStart, NumOfAvailableSamples * sizeof(float));
+			}
+			else
+			{
+				const float ChannelGain = 1.f / NumOfChannels;
+
+				for (int32 SampleIndex = 0; SampleIndex < NumOfAvailableSamples; ++SampleIndex)
+				{
+					const float* SourceFrame = SourceData + (FrameStart + SampleIndex) * NumOfChannels;
+
+					float Sample = 0.f;
+					for (int32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+					{
+						Sample += SourceFrame[ChannelIndex];
+					}
+
+					FrameData[SampleIndex] = Sample * ChannelGain;
+				}
+			}
+
+			FMemory::Memzero(FrameData.GetData() + NumOfAvailableSamples, (FFT.FFTSize - NumOfAvailableSamples) * sizeof(float));
+
+			RuntimeAudioImporter_VectorMath::MultiplyArrays(FrameData.GetData(), Window.GetData(), FrameData.GetData(), FFT.FFTSize);
+
+			FFT.ComputeMagnitudes(FrameData.GetData(), Real.GetData(), Imag.GetData(), Spectrogram.Magnitudes.GetData() + FrameIndex * NumOfBins, Scale);
+		}
+	});
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Successfully generated spectrogram.\nSpectrogram info: %s"), *Spectrogram.ToString()));
+
+	return true;
+}
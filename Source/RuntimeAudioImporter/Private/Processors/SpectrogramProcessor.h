@@ -0,0 +1,23 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDecodedAudioStruct;
+struct FSpectrogramStruct;
+
+class RUNTIMEAUDIOIMPORTER_API SpectrogramProcessor
+{
+public:
+	/**
+	 * Compute the magnitude spectrogram of decoded audio data. Channels are mixed down to mono before the analysis
+	 *
+	 * @param DecodedData Decoded audio data to analyze
+	 * @param FFTSize Number of samples per FFT frame. Must be a power of two
+	 * @param HopSize Number of samples between the starts of consecutive FFT frames
+	 * @param Spectrogram The computed spectrogram
+	 * @return Whether the computation was successful or not
+	 */
+	static bool Generate(const FDecodedAudioStruct& DecodedData, uint32 FFTSize, uint32 HopSize, FSpectrogramStruct& Spectrogram);
+};
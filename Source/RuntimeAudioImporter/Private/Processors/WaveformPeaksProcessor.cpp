@@ -0,0 +1,234 @@
+// Georgy Treshchev 2022.
+
+#include "Processors/WaveformPeaksProcessor.h"
+#include "Processors/AudioVectorMath.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Number of frames covered by a single peak of the finest level */
+	constexpr uint32 BaseFramesPerPeak = 256;
+
+	/** Number of frames processed by a single parallel task. Must be a multiple of BaseFramesPerPeak */
+	constexpr int64 FramesPerTask = 16384;
+
+	/** Accumulates peaks or samples covering different numbers of frames into a single peak */
+	struct FPeakAccumulator
+	{
+		float Min = TNumericLimits<float>::Max();
+		float Max = TNumericLimits<float>::Lowest();
+		double SumOfSquares = 0;
+		int64 NumOfFrames = 0;
+
+		void AddPeak(const FWaveformPeak& Peak, int64 NumOfPeakFrames)
+		{
+			Min = FMath::Min(Min, Peak.Min);
+			Max = FMath::Max(Max, Peak.Max);
+			SumOfSquares += static_cast<double>(Peak.RMS) * Peak.RMS * NumOfPeakFrames;
+			NumOfFrames += NumOfPeakFrames;
+		}
+
+		void AddSample(float Sample)
+		{
+			Min = FMath::Min(Min, Sample);
+			Max = FMath::Max(Max, Sample);
+			SumOfSquares += static_cast<double>(Sample) * Sample;
+			++NumOfFrames;
+		}
+
+		FWaveformPeak Get() const
+		{
+			FWaveformPeak Peak;
+
+			if (NumOfFrames > 0)
+			{
+				Peak.Min = Min;
+				Peak.Max = Max;
+				Peak.RMS = static_cast<float>(FMath::Sqrt(SumOfSquares / NumOfFrames));
+			}
+
+			return Peak;
+		}
+	};
+
+	/**
+	 * Get the number of frames covered by the peak, taking into account that the last peak of a level may be partial
+	 */
+	int64 GetNumOfPeakFrames(const FWaveformPeaksStruct& WaveformPeaks, int32 LevelIndex, int64 PeakIndex)
+	{
+		const int64 FramesPerPeak = WaveformPeaks.GetFramesPerPeak(LevelIndex);
+		return FMath::Min(FramesPerPeak, WaveformPeaks.NumOfFrames - PeakIndex * FramesPerPeak);
+	}
+}
+
+bool WaveformPeaksProcessor::Generate(const FDecodedAudioStruct& DecodedData, FWaveformPeaksStruct& WaveformPeaks)
+{
+	const int64 NumOfFrames = DecodedData.PCMInfo.PCMNumOfFrames;
+	const int32 NumOfChannels = static_cast<int32>(DecodedData.SoundWaveBasicInfo.NumOfChannels);
+
+	if (NumOfChannels <= 0)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to generate waveform peaks for audio data with '%d' channels"), NumOfChannels));
+		return false;
+	}
+
+	WaveformPeaks.BaseFramesPerPeak = BaseFramesPerPeak;
+	WaveformPeaks.NumOfChannels = NumOfChannels;
+	WaveformPeaks.NumOfFrames = NumOfFrames;
+	WaveformPeaks.Levels.Reset();
+
+	if (NumOfFrames == 0)
+	{
+		return true;
+	}
+
+	const float* PCMData = reinterpret_cast<const float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+
+	// Building the finest level directly from the PCM data
+	{
+		const int32 NumOfPeaks = WaveformPeaks.GetNumOfPeaks(0);
+		TArray<FWaveformPeak>& Level = WaveformPeaks.Levels.AddDefaulted_GetRef();
+		Level.SetNumUninitialized(NumOfPeaks * NumOfChannels);
+
+		const int32 NumOfTasks = static_cast<int32>((NumOfFrames + FramesPerTask - 1) / FramesPerTask);
+
+		ParallelFor(NumOfTasks * NumOfChannels, [&](int32 TaskIndex)
+		{
+			const int32 ChannelIndex = TaskIndex / NumOfTasks;
+			const int64 FirstFrame = (TaskIndex % NumOfTasks) * FramesPerTask;
+			const int32 NumOfTaskFrames = static_cast<int32>(FMath::Min(FramesPerTask, NumOfFrames - FirstFrame));
+
+			// Deinterleaving the channel so that the reductions can run on contiguous samples
+			TArray<float> ChannelData;
+			const float* TaskData = PCMData + FirstFrame;
+
+			if (NumOfChannels > 1)
+			{
+				ChannelData.SetNumUninitialized(NumOfTaskFrames);
+
+				const float* InterleavedData = PCMData + FirstFrame * NumOfChannels + ChannelIndex;
+				for (int32 FrameIndex = 0; FrameIndex < NumOfTaskFrames; ++FrameIndex)
+				{
+					ChannelData[FrameIndex] = InterleavedData[FrameIndex * NumOfChannels];
+				}
+
+				TaskData = ChannelData.GetData();
+			}
+
+			FWaveformPeak* TaskPeaks = Level.GetData() + ChannelIndex * NumOfPeaks + FirstFrame / BaseFramesPerPeak;
+
+			for (int32 PeakFrame = 0; PeakFrame < NumOfTaskFrames; PeakFrame += BaseFramesPerPeak)
+			{
+				const int32 NumOfPeakFrames = FMath::Min<int32>(BaseFramesPerPeak, NumOfTaskFrames - PeakFrame);
+
+				float SumOfSquares;
+				FWaveformPeak& Peak = *TaskPeaks++;
+				RuntimeAudioImporter_VectorMath::GetMinMaxSumOfSquares(TaskData + PeakFrame, NumOfPeakFrames, Peak.Min, Peak.Max, SumOfSquares);
+				Peak.RMS = FMath::Sqrt(SumOfSquares / NumOfPeakFrames);
+			}
+		});
+	}
+
+	// Building each coarser level by merging pairs of peaks of the previous one
+	while (WaveformPeaks.GetNumOfPeaks(WaveformPeaks.Levels.Num() - 1) > 1)
+	{
+		const int32 PreviousLevelIndex = WaveformPeaks.Levels.Num() - 1;
+		const int32 NumOfPreviousPeaks = WaveformPeaks.GetNumOfPeaks(PreviousLevelIndex);
+		const int32 NumOfPeaks = WaveformPeaks.GetNumOfPeaks(PreviousLevelIndex + 1);
+
+		TArray<FWaveformPeak> Level;
+		Level.SetNumUninitialized(NumOfPeaks * NumOfChannels);
+
+		ParallelFor(NumOfChannels, [&](int32 ChannelIndex)
+		{
+			const TArrayView<const FWaveformPeak> PreviousPeaks{WaveformPeaks.GetChannelPeaks(PreviousLevelIndex, ChannelIndex)};
+			FWaveformPeak* Peaks = Level.GetData() + ChannelIndex * NumOfPeaks;
+
+			for (int32 PeakIndex = 0; PeakIndex < NumOfPeaks; ++PeakIndex)
+			{
+				FPeakAccumulator Accumulator;
+
+				for (int32 PreviousPeakIndex = PeakIndex * 2; PreviousPeakIndex < FMath::Min(PeakIndex * 2 + 2, NumOfPreviousPeaks); ++PreviousPeakIndex)
+				{
+					Accumulator.AddPeak(PreviousPeaks[PreviousPeakIndex], GetNumOfPeakFrames(WaveformPeaks, PreviousLevelIndex, PreviousPeakIndex));
+				}
+
+				Peaks[PeakIndex] = Accumulator.Get();
+			}
+		});
+
+		WaveformPeaks.Levels.Add(MoveTemp(Level));
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Successfully generated waveform peaks.\nWaveform peaks info: %s"), *WaveformPeaks.ToString()));
+
+	return true;
+}
+
+bool WaveformPeaksProcessor::GetPeaks(const FWaveformPeaksStruct& WaveformPeaks, const float* PCMData, int32 ChannelIndex, int64 StartFrame, int64 EndFrame, int32 NumOfPeaks, TArray<FWaveformPeak>& OutPeaks)
+{
+	StartFrame = FMath::Clamp<int64>(StartFrame, 0, WaveformPeaks.NumOfFrames);
+	EndFrame = FMath::Clamp<int64>(EndFrame, 0, WaveformPeaks.NumOfFrames);
+
+	if (ChannelIndex < 0 || static_cast<uint32>(ChannelIndex) >= WaveformPeaks.NumOfChannels || NumOfPeaks <= 0 || StartFrame >= EndFrame || WaveformPeaks.Levels.Num() == 0)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to get '%d' waveform peaks of channel '%d' in the frame range '%lld' - '%lld'.\nWaveform peaks info: %s"), NumOfPeaks, ChannelIndex, StartFrame, EndFrame, *WaveformPeaks.ToString()));
+		return false;
+	}
+
+	OutPeaks.SetNumUninitialized(NumOfPeaks);
+
+	const double FramesPerOutputPeak = static_cast<double>(EndFrame - StartFrame) / NumOfPeaks;
+
+	auto GetOutputPeakRange = [&](int32 PeakIndex, int64& PeakStartFrame, int64& PeakEndFrame)
+	{
+		PeakStartFrame = StartFrame + static_cast<int64>(PeakIndex * FramesPerOutputPeak);
+		PeakEndFrame = FMath::Clamp<int64>(StartFrame + static_cast<int64>((PeakIndex + 1) * FramesPerOutputPeak), PeakStartFrame + 1, WaveformPeaks.NumOfFrames);
+	};
+
+	// Zoomed in closer than the finest level, so reading the samples directly costs less than BaseFramesPerPeak frames per output peak
+	if (FramesPerOutputPeak < WaveformPeaks.BaseFramesPerPeak && PCMData != nullptr)
+	{
+		const uint32 NumOfChannels = WaveformPeaks.NumOfChannels;
+
+		for (int32 PeakIndex = 0; PeakIndex < NumOfPeaks; ++PeakIndex)
+		{
+			int64 PeakStartFrame, PeakEndFrame;
+			GetOutputPeakRange(PeakIndex, PeakStartFrame, PeakEndFrame);
+
+			FPeakAccumulator Accumulator;
+			for (int64 FrameIndex = PeakStartFrame; FrameIndex < PeakEndFrame; ++FrameIndex)
+			{
+				Accumulator.AddSample(PCMData[FrameIndex * NumOfChannels + ChannelIndex]);
+			}
+
+			OutPeaks[PeakIndex] = Accumulator.Get();
+		}
+
+		return true;
+	}
+
+	// Picking the coarsest level that is still at least as fine as the requested resolution, so each output peak merges at most three stored peaks
+	const int32 LevelIndex = FramesPerOutputPeak < WaveformPeaks.BaseFramesPerPeak ? 0 : FMath::Min<int32>(FMath::FloorLog2_64(static_cast<uint64>(FramesPerOutputPeak / WaveformPeaks.BaseFramesPerPeak)), WaveformPeaks.Levels.Num() - 1);
+	const int64 FramesPerPeak = WaveformPeaks.GetFramesPerPeak(LevelIndex);
+	const TArrayView<const FWaveformPeak> LevelPeaks{WaveformPeaks.GetChannelPeaks(LevelIndex, ChannelIndex)};
+
+	for (int32 PeakIndex = 0; PeakIndex < NumOfPeaks; ++PeakIndex)
+	{
+		int64 PeakStartFrame, PeakEndFrame;
+		GetOutputPeakRange(PeakIndex, PeakStartFrame, PeakEndFrame);
+
+		FPeakAccumulator Accumulator;
+		for (int64 LevelPeakIndex = PeakStartFrame / FramesPerPeak; LevelPeakIndex <= (PeakEndFrame - 1) / FramesPerPeak; ++LevelPeakIndex)
+		{
+			Accumulator.AddPeak(LevelPeaks[static_cast<int32>(LevelPeakIndex)], GetNumOfPeakFrames(WaveformPeaks, LevelIndex, LevelPeakIndex));
+		}
+
+		OutPeaks[PeakIndex] = Accumulator.Get();
+	}
+
+	return true;
+}
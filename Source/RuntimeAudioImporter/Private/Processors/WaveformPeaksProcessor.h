@@ -0,0 +1,36 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDecodedAudioStruct;
+struct FWaveformPeaksStruct;
+struct FWaveformPeak;
+
+class RUNTIMEAUDIOIMPORTER_API WaveformPeaksProcessor
+{
+public:
+	/**
+	 * Compute the min/max/RMS peak pyramid of each channel of decoded audio data
+	 *
+	 * @param DecodedData Decoded audio data to analyze
+	 * @param WaveformPeaks The computed waveform peaks
+	 * @return Whether the computation was successful or not
+	 */
+	static bool Generate(const FDecodedAudioStruct& DecodedData, FWaveformPeaksStruct& WaveformPeaks);
+
+	/**
+	 * Get evenly spaced peaks of a single channel over a range of frames, e.g. one peak per horizontal pixel. Only touches the pyramid level closest to the requested resolution
+	 *
+	 * @param WaveformPeaks Waveform peaks computed with Generate
+	 * @param PCMData Interleaved 32-bit float PCM data the peaks were computed from. Used for resolutions finer than the finest level. May be nullptr
+	 * @param ChannelIndex Index of the channel
+	 * @param StartFrame First frame of the range
+	 * @param EndFrame Frame following the last frame of the range
+	 * @param NumOfPeaks Number of peaks to split the range into
+	 * @param OutPeaks The resulting peaks
+	 * @return Whether the retrieval was successful or not
+	 */
+	static bool GetPeaks(const FWaveformPeaksStruct& WaveformPeaks, const float* PCMData, int32 ChannelIndex, int64 StartFrame, int64 EndFrame, int32 NumOfPeaks, TArray<FWaveformPeak>& OutPeaks);
+};
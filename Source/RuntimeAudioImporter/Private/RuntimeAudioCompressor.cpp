@@ -5,20 +5,24 @@
 #include "RuntimeAudioImporterDefines.h"
 #include "RuntimeAudioImporterTypes.h"
 
+#include "Transcoders/ADPCMTranscoder.h"
 #include "Transcoders/RAWTranscoder.h"
 #include "Transcoders/VorbisTranscoder.h"
 #include "Transcoders/WAVTranscoder.h"
 
+#include "Processors/SilenceProcessor.h"
+
 #include "Async/Async.h"
+#include "AudioThread.h"
+
+#include "AudioCompressionSettingsUtils.h"
 
 #if ENGINE_MAJOR_VERSION < 5
 #include "AudioDevice.h"
-#include "AudioCompressionSettingsUtils.h"
 #endif
 
 namespace
 {
-#if ENGINE_MAJOR_VERSION < 5
 	FName GetPlatformSpecificFormat(const FName& Format)
 	{
 		const FPlatformAudioCookOverrides* CompressionOverrides = FPlatformCompressionUtilities::GetCookOverrides();
@@ -61,7 +65,6 @@ namespace
 
 		return PlatformSpecificFormat;
 	}
-#endif
 }
 
 URuntimeAudioCompressor* URuntimeAudioCompressor::CreateRuntimeAudioCompressor()
@@ -69,196 +72,200 @@ URuntimeAudioCompressor* URuntimeAudioCompressor::CreateRuntimeAudioCompressor()
 	return NewObject<URuntimeAudioCompressor>();
 }
 
-void URuntimeAudioCompressor::CompressSoundWave(UImportedSoundWave* ImportedSoundWaveRef, FCompressedSoundWaveInfo CompressedSoundWaveInfo, uint8 Quality, /*bool bFillCompressedBuffer,*/ bool bFillPCMBuffer, bool bFillRAWWaveBuffer)
+void URuntimeAudioCompressor::CompressSoundWave(UImportedSoundWave* ImportedSoundWaveRef, FCompressedSoundWaveInfo CompressedSoundWaveInfo, uint8 Quality, bool bFillPCMBuffer, bool bFillRAWWaveBuffer, bool bFillCompressedBuffer, ECompressedSoundWaveFormat CompressedFormat)
 {
 	USoundWave* RegularSoundWaveRef = NewObject<USoundWave>(USoundWave::StaticClass());
 
-	if (!RegularSoundWaveRef)
+	if (!RegularSoundWaveRef || !ImportedSoundWaveRef)
 	{
-		BroadcastResult(nullptr);
+		BroadcastResult(nullptr, false);
+		return;
+	}
+
+	if (!ImportedSoundWaveRef->IsPCMDataResident())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to compress the imported sound wave '%s' because its PCM data has been evicted. It is being re-decoded, try again once it is resident"), *ImportedSoundWaveRef->GetName());
+		ImportedSoundWaveRef->ReloadPCMData();
+		BroadcastResult(nullptr, false);
 		return;
 	}
 
 	RegularSoundWaveRef->AddToRoot();
 
-if ENGINE_MAJOR_VERSION < 5
-	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [this, ImportedSoundWaveRef, RegularSoundWaveRef, Quality, bFillPCMBuffer, bFillRAWWaveBuffer, /*bFillCompressedBuffer,*/ CompressedSoundWaveInfo]()
-#else
-	FAudioThread::RunCommandOnAudioThread([this, ImportedSoundWaveRef, RegularSoundWaveRef, Quality, bFillPCMBuffer, bFillRAWWaveBuffer, /*bFillCompressedBuffer,*/ CompressedSoundWaveInfo]()
-#endif
+	// Filling in decoded audio info on the game thread. The PCM data is shared, so the imported sound wave may be released while compressing
+	FDecodedAudioStruct DecodedAudioInfo;
 	{
-		// Filling in decoded audio info
-		FDecodedAudioStruct DecodedAudioInfo;
+		DecodedAudioInfo.PCMInfo = ImportedSoundWaveRef->PCMBufferInfo;
+		FSoundWaveBasicStruct SoundWaveBasicInfo;
 		{
-			DecodedAudioInfo.PCMInfo = ImportedSoundWaveRef->PCMBufferInfo;
-			FSoundWaveBasicStruct SoundWaveBasicInfo;
-			{
-				SoundWaveBasicInfo.NumOfChannels = ImportedSoundWaveRef->NumChannels;
-				SoundWaveBasicInfo.SampleRate = ImportedSoundWaveRef->SamplingRate;
-				SoundWaveBasicInfo.Duration = ImportedSoundWaveRef->Duration;
-			}
-			DecodedAudioInfo.SoundWaveBasicInfo = SoundWaveBasicInfo;
+			SoundWaveBasicInfo.NumOfChannels = ImportedSoundWaveRef->NumChannels;
+			SoundWaveBasicInfo.SampleRate = ImportedSoundWaveRef->SamplingRate;
+			SoundWaveBasicInfo.Duration = ImportedSoundWaveRef->Duration;
 		}
+		DecodedAudioInfo.SoundWaveBasicInfo = SoundWaveBasicInfo;
+	}
 
-		// Filling in the basic information of the sound wave
-		{
-			RegularSoundWaveRef->Duration = DecodedAudioInfo.SoundWaveBasicInfo.Duration;
-			RegularSoundWaveRef->SetSampleRate(DecodedAudioInfo.SoundWaveBasicInfo.SampleRate);
-			RegularSoundWaveRef->NumChannels = DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels;
-			RegularSoundWaveRef->SoundGroup = SOUNDGROUP_Default;
-
-			if (RegularSoundWaveRef->NumChannels == 4)
-			{
-				RegularSoundWaveRef->bIsAmbisonics = 1;
-			}
-
-			RegularSoundWaveRef->bProcedural = false;
-			
-
-			// Filling in the compressed sound wave info
-			{
-				RegularSoundWaveRef->SoundGroup = CompressedSoundWaveInfo.SoundGroup;
-				RegularSoundWaveRef->bLooping = CompressedSoundWaveInfo.bLooping;
-				RegularSoundWaveRef->Volume = CompressedSoundWaveInfo.Volume;
-				RegularSoundWaveRef->Pitch = CompressedSoundWaveInfo.Pitch;
-			}
-		}
+	// Converting and encoding on a background thread, so that neither the game thread nor the audio thread is stalled
+	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [this, RegularSoundWaveRef, DecodedAudioInfo = MoveTemp(DecodedAudioInfo), Quality, bFillPCMBuffer, bFillRAWWaveBuffer, bFillCompressedBuffer, CompressedFormat, CompressedSoundWaveInfo]() mutable
+	{
+		DecodedAudioInfo.PCMInfo = SilenceProcessor::Expand(DecodedAudioInfo.PCMInfo, DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels);
 
-		// Filling in the standard PCM buffer if needed
-		if (bFillPCMBuffer)
+		// Converting to 16-bit PCM once, since both the PCM buffer and the RAW Wave buffer are made of it
+		FSharedPCMBuffer Int16PCMData;
+		if (bFillPCMBuffer || bFillRAWWaveBuffer)
 		{
-			RegularSoundWaveRef->DecompressionType = EDecompressionType::DTYPE_Native;
-			
-
 			int16* RawPCMData;
 			int32 RawPCMDataSize;
 			RAWTranscoder::TranscodeRAWData<float, int16>(reinterpret_cast<float*>(DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData()), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num(), RawPCMData, RawPCMDataSize);
-			RegularSoundWaveRef->RawPCMDataSize = RawPCMDataSize;
-			RegularSoundWaveRef->RawPCMData = static_cast<uint8*>(FMemory::Malloc(RawPCMDataSize));
-			FMemory::Memcpy(RegularSoundWaveRef->RawPCMData, RawPCMData, RawPCMDataSize);
-
-			FMemory::Free(RawPCMData);
 
-			RegularSoundWaveRef->SetPrecacheState(ESoundWavePrecacheState::Done);
-
-			UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Filled PCM Buffer with size '%d'"), RawPCMDataSize);
+			Int16PCMData = FSharedPCMBuffer(reinterpret_cast<uint8*>(RawPCMData), RawPCMDataSize);
 		}
 
-		// Filling in the standard RAW Wave 16-bit buffer if needed
+		// Encoding the 16-bit PCM data to WAV format for the RAW Wave buffer
+		FEncodedAudioStruct WAVEncodedAudioInfo;
 		if (bFillRAWWaveBuffer)
 		{
-			RegularSoundWaveRef->DecompressionType = EDecompressionType::DTYPE_Streaming;
-
-			int16* RawPCMData;
-			int32 RawPCMDataSize;
-			RAWTranscoder::TranscodeRAWData<float, int16>(reinterpret_cast<float*>(DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData()), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num(), RawPCMData, RawPCMDataSize);
-
 			FDecodedAudioStruct CustomDecodedAudioInfo;
 			{
 				CustomDecodedAudioInfo.SoundWaveBasicInfo = DecodedAudioInfo.SoundWaveBasicInfo;
-				CustomDecodedAudioInfo.PCMInfo.PCMData = FBulkDataBuffer<uint8>(reinterpret_cast<uint8*>(RawPCMData), RawPCMDataSize);
+				CustomDecodedAudioInfo.PCMInfo.PCMData = Int16PCMData;
 				CustomDecodedAudioInfo.PCMInfo.PCMNumOfFrames = DecodedAudioInfo.PCMInfo.PCMNumOfFrames;
 			}
 
-			// Encoding to WAV format
-			FEncodedAudioStruct EncodedAudioInfo;
-			if (!WAVTranscoder::Encode(CustomDecodedAudioInfo, EncodedAudioInfo, FWAVEncodingFormat(EWAVEncodingFormat::FORMAT_PCM, 16)))
+			if (!WAVTranscoder::Encode(CustomDecodedAudioInfo, WAVEncodedAudioInfo, FWAVEncodingFormat(EWAVEncodingFormat::FORMAT_PCM, 16)))
 			{
 				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to encode PCM to WAV format due to transcoder error"));
-				BroadcastResult(nullptr);
+				BroadcastResult(RegularSoundWaveRef, false);
 				return;
 			}
+		}
 
-			RegularSoundWaveRef->RawData.Lock(LOCK_READ_WRITE);
-			FMemory::Memcpy(RegularSoundWaveRef->RawData.Realloc(EncodedAudioInfo.AudioData.GetView().Num()), EncodedAudioInfo.AudioData.GetView().GetData(), EncodedAudioInfo.AudioData.GetView().Num());
-			RegularSoundWaveRef->RawData.Unlock();
-
-			RegularSoundWaveRef->SetPrecacheState(ESoundWavePrecacheState::Done);
+		// Encoding to the chosen format for the compressed buffer
+		FEncodedAudioStruct CompressedEncodedAudioInfo;
+		if (bFillCompressedBuffer)
+		{
+			const bool bEncoded{CompressedFormat == ECompressedSoundWaveFormat::ADPCM ? ADPCMTranscoder::Encode(DecodedAudioInfo, CompressedEncodedAudioInfo) : VorbisTranscoder::Encode(DecodedAudioInfo, CompressedEncodedAudioInfo, Quality)};
 
-			UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Filled RAW Wave Buffer with size '%d'"), EncodedAudioInfo.AudioData.GetView().Num());
+			if (!bEncoded || CompressedEncodedAudioInfo.AudioData.GetView().Num() <= 0)
+			{
+				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to encode PCM to %s format due to transcoder error"), CompressedFormat == ECompressedSoundWaveFormat::ADPCM ? TEXT("ADPCM") : TEXT("Vorbis"));
+				BroadcastResult(RegularSoundWaveRef, false);
+				return;
+			}
 		}
 
-		/* //Compressed audio just doesn't work, there's no decoder created.
-		   // TODO: Work out where decoder should go
+		// The 16-bit PCM data is handed over to the PCM buffer as is, without copying
+		const int32 RawPCMDataSize = static_cast<int32>(Int16PCMData.GetView().Num());
+		uint8* RawPCMData = bFillPCMBuffer ? Int16PCMData.Release() : nullptr;
 
-		// Filling in the compressed OGG buffer
-		if (bFillCompressedBuffer)
+		// Handing the prepared data over to the sound wave on the audio thread, since the audio renderer reads the sound wave resources
+		FAudioThread::RunCommandOnAudioThread([this, RegularSoundWaveRef, SoundWaveBasicInfo = DecodedAudioInfo.SoundWaveBasicInfo, RawPCMData, RawPCMDataSize, WAVEncodedAudioInfo = MoveTemp(WAVEncodedAudioInfo), CompressedEncodedAudioInfo = MoveTemp(CompressedEncodedAudioInfo), bFillPCMBuffer, bFillRAWWaveBuffer, bFillCompressedBuffer, CompressedFormat, CompressedSoundWaveInfo]()
 		{
-			RegularSoundWaveRef->DecompressionType = EDecompressionType::DTYPE_RealTime;
-			FEncodedAudioStruct EncodedAudioInfo;
-			if (!VorbisTranscoder::Encode(DecodedAudioInfo, EncodedAudioInfo, Quality))
+			// Filling in the basic information of the sound wave
 			{
-				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while encoding Vorbis audio data"));
+				RegularSoundWaveRef->Duration = SoundWaveBasicInfo.Duration;
+				RegularSoundWaveRef->SetSampleRate(SoundWaveBasicInfo.SampleRate);
+				RegularSoundWaveRef->NumChannels = SoundWaveBasicInfo.NumOfChannels;
+				RegularSoundWaveRef->SoundGroup = SOUNDGROUP_Default;
+
+				if (RegularSoundWaveRef->NumChannels == 4)
+				{
+					RegularSoundWaveRef->bIsAmbisonics = 1;
+				}
+
+				RegularSoundWaveRef->bProcedural = false;
+
+				// Filling in the compressed sound wave info
+				{
+					RegularSoundWaveRef->SoundGroup = CompressedSoundWaveInfo.SoundGroup;
+					RegularSoundWaveRef->bLooping = CompressedSoundWaveInfo.bLooping;
+					RegularSoundWaveRef->Volume = CompressedSoundWaveInfo.Volume;
+					RegularSoundWaveRef->Pitch = CompressedSoundWaveInfo.Pitch;
+				}
 			}
 
-			if (EncodedAudioInfo.AudioData.GetView().Num() <= 0)
+			// Filling in the standard PCM buffer if needed
+			if (bFillPCMBuffer)
 			{
-				BroadcastResult(nullptr);
-				return;
-			}
+				RegularSoundWaveRef->DecompressionType = EDecompressionType::DTYPE_Native;
 
-			RegularSoundWaveRef->SetPrecacheState(ESoundWavePrecacheState::NotStarted);
-			RegularSoundWaveRef->SetPrecacheState(ESoundWavePrecacheState::InProgress);
+				RegularSoundWaveRef->RawPCMDataSize = RawPCMDataSize;
+				RegularSoundWaveRef->RawPCMData = RawPCMData;
 
-			{
-#if ENGINE_MAJOR_VERSION < 5
+				RegularSoundWaveRef->SetPrecacheState(ESoundWavePrecacheState::Done);
 
-				static const FName NAME_OGG{TEXT("OGG")};
+				UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Filled PCM Buffer with size '%d'"), RawPCMDataSize);
+			}
 
-				// Getting the name of the current compressed platform-specific audio format
-				const FName CurrentAudioPlatformSpecificFormat{GetPlatformSpecificFormat(NAME_OGG)};
+			// Filling in the standard RAW Wave 16-bit buffer if needed
+			if (bFillRAWWaveBuffer)
+			{
+				RegularSoundWaveRef->DecompressionType = EDecompressionType::DTYPE_Streaming;
 
-				// Getting the compressed bulk data
-				FByteBulkData* CompressedBulkDataPtr = &RegularSoundWaveRef->CompressedFormatData.GetFormat(CurrentAudioPlatformSpecificFormat);
+				RegularSoundWaveRef->RawData.Lock(LOCK_READ_WRITE);
+				FMemory::Memcpy(RegularSoundWaveRef->RawData.Realloc(WAVEncodedAudioInfo.AudioData.GetView().Num()), WAVEncodedAudioInfo.AudioData.GetView().GetData(), WAVEncodedAudioInfo.AudioData.GetView().Num());
+				RegularSoundWaveRef->RawData.Unlock();
 
-#else
+				RegularSoundWaveRef->SetPrecacheState(ESoundWavePrecacheState::Done);
 
-				FByteBulkData CompressedBulkData;
-				FByteBulkData* CompressedBulkDataPtr = &CompressedBulkData;
+				UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Filled RAW Wave Buffer with size '%d'"), WAVEncodedAudioInfo.AudioData.GetView().Num());
+			}
 
-#endif
+			// Filling in the compressed buffer, which the engine decodes in real time during playback
+			if (bFillCompressedBuffer)
+			{
+				static const FName NAME_OGG{TEXT("OGG")};
+				static const FName NAME_ADPCM{TEXT("ADPCM")};
 
+				const FName& CompressedFormatName = CompressedFormat == ECompressedSoundWaveFormat::ADPCM ? NAME_ADPCM : NAME_OGG;
 
-				// Filling in the compressed data
+				// Storing the compressed data under the platform-specific format name, which is where the engine looks for it when choosing the real-time decoder
+				FByteBulkData& CompressedBulkData = RegularSoundWaveRef->CompressedFormatData.GetFormat(GetPlatformSpecificFormat(CompressedFormatName));
 				{
-					CompressedBulkDataPtr->Lock(LOCK_READ_WRITE);
-					FMemory::Memcpy(CompressedBulkDataPtr->Realloc(EncodedAudioInfo.AudioData.GetView().Num()), EncodedAudioInfo.AudioData.GetView().GetData(), EncodedAudioInfo.AudioData.GetView().Num());
-					CompressedBulkDataPtr->Unlock();
+					CompressedBulkData.Lock(LOCK_READ_WRITE);
+					FMemory::Memcpy(CompressedBulkData.Realloc(CompressedEncodedAudioInfo.AudioData.GetView().Num()), CompressedEncodedAudioInfo.AudioData.GetView().GetData(), CompressedEncodedAudioInfo.AudioData.GetView().Num());
+					CompressedBulkData.Unlock();
 				}
 
-#if ENGINE_MAJOR_VERSION >= 5
-				RegularSoundWaveRef->InitAudioResource(*CompressedBulkDataPtr);
+				RegularSoundWaveRef->DecompressionType = EDecompressionType::DTYPE_RealTime;
+
+				// Initializing the audio resource right away, so that the decoder is created from the compressed data instead of looking for cooked data
+#if ENGINE_MAJOR_VERSION < 5
+				RegularSoundWaveRef->InitAudioResource(CompressedFormatName);
+#else
+				RegularSoundWaveRef->InitAudioResource(CompressedBulkData);
 #endif
-			}
 
-			RegularSoundWaveRef->SetPrecacheState(ESoundWavePrecacheState::Done);
+				RegularSoundWaveRef->SetPrecacheState(ESoundWavePrecacheState::Done);
 
-			UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Filled in the compressed audio buffer 'OGG' with size '%d'"), EncodedAudioInfo.AudioData.GetView().Num());
-		}*/
+				UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Filled in the compressed audio buffer '%s' with size '%d'"), *CompressedFormatName.ToString(), CompressedEncodedAudioInfo.AudioData.GetView().Num());
+			}
 
-		BroadcastResult(RegularSoundWaveRef);
+			BroadcastResult(RegularSoundWaveRef, true);
+		});
 	});
 }
 
-void URuntimeAudioCompressor::BroadcastResult(USoundWave* SoundWaveRef)
+void URuntimeAudioCompressor::BroadcastResult(USoundWave* SoundWaveRef, bool bSuccess)
 {
-	AsyncTask(ENamedThreads::GameThread, [this, SoundWaveRef]()
+	AsyncTask(ENamedThreads::GameThread, [this, SoundWaveRef, bSuccess]()
 	{
 		bool bBroadcasted{false};
-		const bool bSuccess{SoundWaveRef != nullptr};
+		USoundWave* const ResultSoundWaveRef{bSuccess ? SoundWaveRef : nullptr};
 
 		if (OnResultNative.IsBound())
 		{
 			bBroadcasted = true;
-			OnResultNative.Broadcast(bSuccess, SoundWaveRef);
+			OnResultNative.Broadcast(bSuccess, ResultSoundWaveRef);
 		}
 
 		if (OnResult.IsBound())
 		{
 			bBroadcasted = true;
-			OnResult.Broadcast(bSuccess, SoundWaveRef);
+			OnResult.Broadcast(bSuccess, ResultSoundWaveRef);
 		}
 
+		// Removing the sound wave from the root on failure as well, so that the partially filled sound wave is garbage collected
 		if (SoundWaveRef != nullptr)
 		{
 			SoundWaveRef->RemoveFromRoot();
@@ -18,3 +18,18 @@ void FRuntimeAudioImporterModule::ShutdownModule()
 IMPLEMENT_MODULE(FRuntimeAudioImporterModule, RuntimeAudioImporter)
 
 DEFINE_LOG_CATEGORY(LogRuntimeAudioImporter);
+
+DEFINE_STAT(STAT_RuntimeAudioImporter_Read);
+DEFINE_STAT(STAT_RuntimeAudioImporter_Probe);
+DEFINE_STAT(STAT_RuntimeAudioImporter_DecodeMp3);
+DEFINE_STAT(STAT_RuntimeAudioImporter_DecodeWav);
+DEFINE_STAT(STAT_RuntimeAudioImporter_DecodeFlac);
+DEFINE_STAT(STAT_RuntimeAudioImporter_DecodeVorbis);
+DEFINE_STAT(STAT_RuntimeAudioImporter_TranscodeRAW);
+DEFINE_STAT(STAT_RuntimeAudioImporter_Process);
+DEFINE_STAT(STAT_RuntimeAudioImporter_Encode);
+DEFINE_STAT(STAT_RuntimeAudioImporter_Finalize);
+DEFINE_STAT(STAT_RuntimeAudioImporter_GeneratePCMAudio);
+DEFINE_STAT(STAT_RuntimeAudioImporter_LivePCMData);
+
+UE_TRACE_CHANNEL_DEFINE(RuntimeAudioImporterChannel);
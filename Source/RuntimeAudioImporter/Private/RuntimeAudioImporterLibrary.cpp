@@ -5,6 +5,7 @@
 #include "RuntimeAudioImporterDefines.h"
 #include "RuntimeAudioImporterTypes.h"
 #include "PreImportedSoundAsset.h"
+#include "ImportedAudioMemoryManager.h"
 
 #include "Transcoders/MP3Transcoder.h"
 #include "Transcoders/WAVTranscoder.h"
@@ -12,8 +13,138 @@
 #include "Transcoders/VorbisTranscoder.h"
 #include "Transcoders/RAWTranscoder.h"
 
+#include "Processors/ResampleProcessor.h"
+#include "Processors/ChannelMixProcessor.h"
+#include "Processors/SpectrogramProcessor.h"
+#include "Processors/WaveformPeaksProcessor.h"
+#include "Processors/LoudnessProcessor.h"
+#include "Processors/SilenceProcessor.h"
+
 #include "Misc/FileHelper.h"
 #include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	/** Progress percentage reached once the audio data is decoded. Decoding progress is mapped to the range up to this value */
+	constexpr int32 DecodedProgressPercentage = 80;
+
+	/** Progress percentage reached once the decoded audio data is processed */
+	constexpr int32 ProcessedProgressPercentage = 90;
+
+	/** Minimum expected throughput of imports, in seconds of audio per second of wall time. Zero means there is no minimum */
+	float MinImportThroughput = 0.f;
+
+	FAutoConsoleVariableRef CVarMinImportThroughput(
+		TEXT("au.RuntimeAudioImporter.MinImportThroughput"),
+		MinImportThroughput,
+		TEXT("Minimum expected throughput of imports, in seconds of audio decoded and processed per second of wall time. Successful imports below it are reported with a warning, e.g. to catch performance regressions in automated runs.\n")
+		TEXT("0: no minimum (default)"),
+		ECVF_Default);
+
+	/**
+	 * Get the audio format from the signature at the start of the audio data. Only the signatures of a single supported format are recognized (e.g. an Ogg container is recognized only by the Vorbis identification header in its first page)
+	 *
+	 * @return The recognized audio format, or Invalid if the signature is not recognized
+	 */
+	EAudioFormat GetAudioFormatBySignature(const uint8* AudioData, int32 AudioDataSize)
+	{
+		if (AudioData == nullptr || AudioDataSize < 12)
+		{
+			return EAudioFormat::Invalid;
+		}
+
+		auto HasSignature = [AudioData](int32 Offset, const ANSICHAR* Signature, int32 SignatureSize)
+		{
+			return FMemory::Memcmp(AudioData + Offset, Signature, SignatureSize) == 0;
+		};
+
+		if ((HasSignature(0, "RIFF", 4) || HasSignature(0, "RF64", 4)) && HasSignature(8, "WAVE", 4))
+		{
+			return EAudioFormat::Wav;
+		}
+
+		if (HasSignature(0, "fLaC", 4))
+		{
+			return EAudioFormat::Flac;
+		}
+
+		if (HasSignature(0, "ID3", 3))
+		{
+			return EAudioFormat::Mp3;
+		}
+
+		// The first Ogg page holds only the identification header of the logical stream, which starts right after the segment table
+		if (HasSignature(0, "OggS", 4) && AudioDataSize >= 27)
+		{
+			const int32 IdentificationHeaderOffset = 27 + AudioData[26];
+			if (IdentificationHeaderOffset + 7 <= AudioDataSize && HasSignature(IdentificationHeaderOffset, "\x01vorbis", 7))
+			{
+				return EAudioFormat::OggVorbis;
+			}
+
+			return EAudioFormat::Invalid;
+		}
+
+		// MPEG audio frame sync, followed by a header with none of the reserved values of version, layer, bitrate, sample rate and emphasis
+		if (AudioData[0] == 0xFF && (AudioData[1] & 0xE0) == 0xE0)
+		{
+			const uint8 Version = (AudioData[1] >> 3) & 0x03;
+			const uint8 Layer = (AudioData[1] >> 1) & 0x03;
+			const uint8 BitrateIndex = (AudioData[2] >> 4) & 0x0F;
+			const uint8 SampleRateIndex = (AudioData[2] >> 2) & 0x03;
+			const uint8 Emphasis = AudioData[3] & 0x03;
+
+			if (Version != 0x01 && Layer != 0x00 && BitrateIndex != 0x0F && SampleRateIndex != 0x03 && Emphasis != 0x02)
+			{
+				return EAudioFormat::Mp3;
+			}
+		}
+
+		return EAudioFormat::Invalid;
+	}
+
+	/**
+	 * Check whether the audio data can be opened by the decoder of the specified format
+	 */
+	bool CheckAudioFormat(EAudioFormat AudioFormat, const uint8* AudioData, int32 AudioDataSize)
+	{
+		switch (AudioFormat)
+		{
+		case EAudioFormat::Mp3:
+			return MP3Transcoder::CheckAudioFormat(AudioData, AudioDataSize);
+		case EAudioFormat::Wav:
+			return WAVTranscoder::CheckAudioFormat(AudioData, AudioDataSize);
+		case EAudioFormat::Flac:
+			return FlacTranscoder::CheckAudioFormat(AudioData, AudioDataSize);
+		case EAudioFormat::OggVorbis:
+			return VorbisTranscoder::CheckAudioFormat(AudioData, AudioDataSize);
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * Get the basic information of the audio data with the decoder of the specified format
+	 */
+	bool GetAudioInfoByFormat(EAudioFormat AudioFormat, const uint8* AudioData, int32 AudioDataSize, FSoundWaveBasicStruct& BasicInfo)
+	{
+		switch (AudioFormat)
+		{
+		case EAudioFormat::Mp3:
+			return MP3Transcoder::GetAudioInfo(AudioData, AudioDataSize, BasicInfo);
+		case EAudioFormat::Wav:
+			return WAVTranscoder::GetAudioInfo(AudioData, AudioDataSize, BasicInfo);
+		case EAudioFormat::Flac:
+			return FlacTranscoder::GetAudioInfo(AudioData, AudioDataSize, BasicInfo);
+		case EAudioFormat::OggVorbis:
+			return VorbisTranscoder::GetAudioInfo(AudioData, AudioDataSize, BasicInfo);
+		default:
+			return false;
+		}
+	}
+}
 
 URuntimeAudioImporterLibrary* URuntimeAudioImporterLibrary::CreateRuntimeAudioImporter()
 {
@@ -22,6 +153,9 @@ URuntimeAudioImporterLibrary* URuntimeAudioImporterLibrary::CreateRuntimeAudioIm
 
 bool LoadAudioFileToArray(TArray<uint8>& AudioData, const FString& FilePath)
 {
+	SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_Read);
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE("LoadAudioFileToArray");
+
 	// Filling AudioBuffer with a binary file
 	if (!FFileHelper::LoadFileToArray(AudioData, *FilePath))
 	{
@@ -36,6 +170,8 @@ bool LoadAudioFileToArray(TArray<uint8>& AudioData, const FString& FilePath)
 
 void URuntimeAudioImporterLibrary::ImportAudioFromFile(const FString& FilePath, EAudioFormat Format)
 {
+	ResetProgress_Internal();
+
 	// Checking if the file exists
 	if (!FPaths::FileExists(FilePath))
 	{
@@ -47,20 +183,25 @@ void URuntimeAudioImporterLibrary::ImportAudioFromFile(const FString& FilePath,
 	Format = Format == EAudioFormat::Auto ? GetAudioFormat(FilePath) : Format;
 	Format = Format == EAudioFormat::Invalid ? EAudioFormat::Auto : Format;
 
+	FImportTimingReport TimingReport;
 	TArray<uint8> AudioBuffer;
 
 	// Filling AudioBuffer with a binary file
 	if (!LoadAudioFileToArray(AudioBuffer, *FilePath))
 	{
-		OnResult_Internal(nullptr, ETranscodingStatus::LoadFileToArrayError);
+		OnResult_Internal(nullptr, ETranscodingStatus::LoadFileToArrayError, TimingReport);
 		return;
 	}
 
-	ImportAudioFromBuffer(MoveTemp(AudioBuffer), Format);
+	TimingReport.ReadTime = FPlatformTime::Seconds() - TimingReport.StartTime;
+
+	ImportAudioFromBuffer_Internal(MoveTemp(AudioBuffer), Format, TimingReport);
 }
 
 void URuntimeAudioImporterLibrary::ImportAudioFromRAWFile(const FString& FilePath, ERAWAudioFormat Format, int32 SampleRate, int32 NumOfChannels)
 {
+	ResetProgress_Internal();
+
 	if (!FPaths::FileExists(FilePath))
 	{
 		OnResult_Internal(nullptr, ETranscodingStatus::AudioDoesNotExist);
@@ -69,23 +210,34 @@ void URuntimeAudioImporterLibrary::ImportAudioFromRAWFile(const FString& FilePat
 
 	OnProgress_Internal(5);
 
+	FImportTimingReport TimingReport;
 	TArray<uint8> AudioBuffer;
 	if (!LoadAudioFileToArray(AudioBuffer, *FilePath))
 	{
-		OnResult_Internal(nullptr, ETranscodingStatus::LoadFileToArrayError);
+		OnResult_Internal(nullptr, ETranscodingStatus::LoadFileToArrayError, TimingReport);
 		return;
 	}
 
-	OnProgress_Internal(35);
+	TimingReport.ReadTime = FPlatformTime::Seconds() - TimingReport.StartTime;
 
-	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [this, AudioBuffer = MoveTemp(AudioBuffer), Format, SampleRate, NumOfChannels]()
+	OnProgress_Internal(DecodedProgressPercentage / 2);
+
+	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [this, AudioBuffer = MoveTemp(AudioBuffer), Format, SampleRate, NumOfChannels, TimingReport]()
 	{
-		ImportAudioFromRAWBuffer(AudioBuffer, Format, SampleRate, NumOfChannels);
+		ImportAudioFromRAWBuffer_Internal(AudioBuffer, Format, SampleRate, NumOfChannels, TimingReport);
 	});
 }
 
 void URuntimeAudioImporterLibrary::ImportAudioFromRAWBuffer(TArray<uint8> RAWBuffer, ERAWAudioFormat Format, int32 SampleRate, int32 NumOfChannels)
 {
+	ResetProgress_Internal();
+	ImportAudioFromRAWBuffer_Internal(MoveTemp(RAWBuffer), Format, SampleRate, NumOfChannels, FImportTimingReport());
+}
+
+void URuntimeAudioImporterLibrary::ImportAudioFromRAWBuffer_Internal(TArray<uint8> RAWBuffer, ERAWAudioFormat Format, int32 SampleRate, int32 NumOfChannels, FImportTimingReport TimingReport)
+{
+	const double DecodeStartTime = FPlatformTime::Seconds();
+
 	uint8* RAWData{RAWBuffer.GetData()};
 	const int32 RAWDataSize{RAWBuffer.Num()};
 
@@ -122,56 +274,142 @@ void URuntimeAudioImporterLibrary::ImportAudioFromRAWBuffer(TArray<uint8> RAWBuf
 
 	if (!PCMData || PCMDataSize < 0)
 	{
-		OnResult_Internal(nullptr, ETranscodingStatus::FailedToReadAudioDataArray);
+		OnResult_Internal(nullptr, ETranscodingStatus::FailedToReadAudioDataArray, TimingReport);
 		return;
 	}
 
-	ImportAudioFromFloat32Buffer(reinterpret_cast<uint8*>(PCMData), PCMDataSize, SampleRate, NumOfChannels);
+	{
+		TimingReport.DecodeTime = FPlatformTime::Seconds() - DecodeStartTime;
+		TimingReport.InputSize = RAWDataSize;
+		TimingReport.UpdatePeakAllocationSize(RAWDataSize + static_cast<int64>(PCMDataSize));
+	}
+
+	ImportAudioFromFloat32Buffer_Internal(reinterpret_cast<uint8*>(PCMData), PCMDataSize, SampleRate, NumOfChannels, TimingReport);
 }
 
 void URuntimeAudioImporterLibrary::ImportAudioFromPreImportedSound(UPreImportedSoundAsset* PreImportedSoundAssetRef)
 {
-	ImportAudioFromBuffer(PreImportedSoundAssetRef->AudioDataArray, PreImportedSoundAssetRef->AudioFormat);
+	ResetProgress_Internal();
+
+	const bool bPreDecoded{PreImportedSoundAssetRef->HasPreDecodedAudioData()};
+	const ERAWAudioFormat RAWFormat{PreImportedSoundAssetRef->CookFormat == EPreImportedSoundCookFormat::Int16 ? ERAWAudioFormat::Int16 : ERAWAudioFormat::Float32};
+
+	// The audio data is streamed from the bulk data of the asset, so it is not resident until imported
+	PreImportedSoundAssetRef->LoadAudioDataAsync([this, bPreDecoded, RAWFormat, SampleRate = PreImportedSoundAssetRef->PreDecodedSampleRate, NumOfChannels = PreImportedSoundAssetRef->PreDecodedNumOfChannels, AudioFormat = PreImportedSoundAssetRef->AudioFormat, TimingReport = FImportTimingReport()](TArray<uint8> AudioData) mutable
+	{
+		if (AudioData.Num() == 0)
+		{
+			OnResult_Internal(nullptr, ETranscodingStatus::FailedToReadAudioDataArray, TimingReport);
+			return;
+		}
+
+		TimingReport.ReadTime = FPlatformTime::Seconds() - TimingReport.StartTime;
+
+		// The audio data pre-decoded while cooking is imported without format detection and decoding
+		if (bPreDecoded)
+		{
+			ImportAudioFromRAWBuffer_Internal(MoveTemp(AudioData), RAWFormat, SampleRate, NumOfChannels, TimingReport);
+		}
+		else
+		{
+			ImportAudioFromBuffer_Internal(MoveTemp(AudioData), AudioFormat, TimingReport);
+		}
+	});
 }
 
 void URuntimeAudioImporterLibrary::ImportAudioFromBuffer(TArray<uint8> AudioData, EAudioFormat AudioFormat)
+{
+	ResetProgress_Internal();
+	ImportAudioFromBuffer_Internal(MoveTemp(AudioData), AudioFormat, FImportTimingReport());
+}
+
+void URuntimeAudioImporterLibrary::ImportAudioFromBuffer_Internal(TArray<uint8> AudioData, EAudioFormat AudioFormat, FImportTimingReport TimingReport)
 {
 	if (AudioFormat == EAudioFormat::Wav && !WAVTranscoder::CheckAndFixWavDurationErrors(AudioData)) return;
 
-	if (AudioFormat == EAudioFormat::Auto)
-	{
-		AudioFormat = GetAudioFormat(AudioData.GetData(), AudioData.Num());
-	}
+	TimingReport.InputSize = AudioData.Num();
+
+	// The encoded audio data is retained in the imported sound wave only if its PCM data may be evicted to fit the memory budget
+	const bool bRetainEncodedAudioData{FImportedAudioMemoryManager::Get().IsBudgetEnabled()};
+	TSharedPtr<FEncodedAudioSourceStruct, ESPMode::ThreadSafe> EncodedAudioSource = MakeShared<FEncodedAudioSourceStruct, ESPMode::ThreadSafe>(MoveTemp(AudioData), AudioFormat, ImportSettings);
 
-	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [this, AudioData = MoveTemp(AudioData), AudioFormat]()
+	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [this, EncodedAudioSource, bRetainEncodedAudioData, AudioFormat, ImportSettings = ImportSettings, TimingReport]() mutable
 	{
 		OnProgress_Internal(5);
 
+		// Probing only the audio data whose format is not recognized by its signature. A recognized format is validated by its decoder while decoding, so the decoder is not opened twice
+		if (AudioFormat == EAudioFormat::Auto && GetAudioFormatBySignature(EncodedAudioSource->AudioData.GetData(), EncodedAudioSource->AudioData.Num()) == EAudioFormat::Invalid)
+		{
+			const double ProbeStartTime = FPlatformTime::Seconds();
+			AudioFormat = GetAudioFormat(EncodedAudioSource->AudioData.GetData(), EncodedAudioSource->AudioData.Num());
+			TimingReport.ProbeTime = FPlatformTime::Seconds() - ProbeStartTime;
+		}
+
+		TimingReport.AudioFormat = AudioFormat;
+
 		if (AudioFormat == EAudioFormat::Invalid)
 		{
 			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Undefined audio data format for import"));
-			OnResult_Internal(nullptr, ETranscodingStatus::InvalidAudioFormat);
+			OnResult_Internal(nullptr, ETranscodingStatus::InvalidAudioFormat, TimingReport);
 			return;
 		}
 
+		const double DecodeStartTime = FPlatformTime::Seconds();
+
+		const TArray<uint8>& AudioData = EncodedAudioSource->AudioData;
 		uint8* EncodedAudioDataPtr = static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(AudioData.Num()), AudioData.GetData(), AudioData.Num()));
 
 		FEncodedAudioStruct EncodedAudioInfo(EncodedAudioDataPtr, AudioData.Num(), AudioFormat);
 
-		OnProgress_Internal(10);
-
+		// Mapping the decoded fraction reported by the decoder to the progress percentage
 		FDecodedAudioStruct DecodedAudioInfo;
-		if (!DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo))
+		if (!DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo, [this](float DecodedFraction)
 		{
-			OnResult_Internal(nullptr, ETranscodingStatus::FailedToReadAudioDataArray);
+			OnProgress_Internal(5 + FMath::RoundToInt(DecodedFraction * (DecodedProgressPercentage - 5)));
+		}))
+		{
+			OnResult_Internal(nullptr, ETranscodingStatus::FailedToReadAudioDataArray, TimingReport);
 			return;
 		}
 
-		OnProgress_Internal(65);
+		// Keeping the format determined while decoding, so that the retained audio data is not probed again when re-decoded
+		{
+			TimingReport.AudioFormat = EncodedAudioInfo.AudioFormat;
+			EncodedAudioSource->AudioFormat = EncodedAudioInfo.AudioFormat;
+		}
+
+		// The encoded audio data is held twice while decoding: by the caller and by the decoder
+		const int64 DecodedDataSize = DecodedAudioInfo.PCMInfo.PCMData.GetView().Num();
+		const uint8* DecodedData = DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData();
+		{
+			TimingReport.DecodeTime = FPlatformTime::Seconds() - DecodeStartTime;
+			TimingReport.UpdatePeakAllocationSize(2 * TimingReport.InputSize + DecodedDataSize);
+		}
+
+		OnProgress_Internal(DecodedProgressPercentage);
+
+		const double ProcessStartTime = FPlatformTime::Seconds();
 
-		AsyncTask(ENamedThreads::GameThread, [this, DecodedAudioInfo = MoveTemp(DecodedAudioInfo)]()
+		if (!ProcessDecodedAudioData(DecodedAudioInfo, ImportSettings))
 		{
-			ImportAudioFromDecodedInfo(DecodedAudioInfo);
+			OnResult_Internal(nullptr, ETranscodingStatus::FailedToProcessAudioData, TimingReport);
+			return;
+		}
+
+		// A processing stage that reallocates the PCM data holds the old and the new data at the same time
+		{
+			TimingReport.ProcessTime = FPlatformTime::Seconds() - ProcessStartTime;
+			if (DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData() != DecodedData)
+			{
+				TimingReport.UpdatePeakAllocationSize(2 * TimingReport.InputSize + DecodedDataSize + DecodedAudioInfo.PCMInfo.PCMData.GetView().Num());
+			}
+		}
+
+		OnProgress_Internal(ProcessedProgressPercentage);
+
+		AsyncTask(ENamedThreads::GameThread, [this, DecodedAudioInfo = MoveTemp(DecodedAudioInfo), EncodedAudioSource = bRetainEncodedAudioData ? TSharedPtr<const FEncodedAudioSourceStruct, ESPMode::ThreadSafe>(EncodedAudioSource) : TSharedPtr<const FEncodedAudioSourceStruct, ESPMode::ThreadSafe>(), TimingReport]()
+		{
+			ImportAudioFromDecodedInfo_Internal(DecodedAudioInfo, EncodedAudioSource, TimingReport);
 		});
 	});
 }
@@ -279,10 +517,17 @@ bool URuntimeAudioImporterLibrary::ExportSoundWaveToFile(UImportedSoundWave* Imp
 
 bool URuntimeAudioImporterLibrary::ExportSoundWaveToBuffer(UImportedSoundWave* ImporterSoundWave, TArray<uint8>& AudioData, EAudioFormat AudioFormat, uint8 Quality)
 {
+	if (!ImporterSoundWave->IsPCMDataResident())
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to export the sound wave '%s' because its PCM data has been evicted. It is being re-decoded, try again once it is resident"), *ImporterSoundWave->GetName());
+		ImporterSoundWave->ReloadPCMData();
+		return false;
+	}
+
 	// Filling in decoded audio info
 	FDecodedAudioStruct DecodedAudioInfo;
 	{
-		DecodedAudioInfo.PCMInfo = ImporterSoundWave->PCMBufferInfo;
+		DecodedAudioInfo.PCMInfo = SilenceProcessor::Expand(ImporterSoundWave->PCMBufferInfo, ImporterSoundWave->NumChannels);
 		FSoundWaveBasicStruct SoundWaveBasicInfo;
 		{
 			SoundWaveBasicInfo.NumOfChannels = ImporterSoundWave->NumChannels;
@@ -309,37 +554,55 @@ bool URuntimeAudioImporterLibrary::ExportSoundWaveToBuffer(UImportedSoundWave* I
 	return true;
 }
 
-void URuntimeAudioImporterLibrary::ImportAudioFromDecodedInfo(const FDecodedAudioStruct& DecodedAudioInfo)
+void URuntimeAudioImporterLibrary::ImportAudioFromDecodedInfo(const FDecodedAudioStruct& DecodedAudioInfo, const TSharedPtr<const FEncodedAudioSourceStruct, ESPMode::ThreadSafe>& EncodedAudioSource)
+{
+	ResetProgress_Internal();
+	ImportAudioFromDecodedInfo_Internal(DecodedAudioInfo, EncodedAudioSource, FImportTimingReport());
+}
+
+void URuntimeAudioImporterLibrary::ImportAudioFromDecodedInfo_Internal(const FDecodedAudioStruct& DecodedAudioInfo, const TSharedPtr<const FEncodedAudioSourceStruct, ESPMode::ThreadSafe>& EncodedAudioSource, FImportTimingReport TimingReport)
 {
+	SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_Finalize);
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("URuntimeAudioImporterLibrary::ImportAudioFromDecodedInfo", DecodedAudioInfo.PCMInfo.PCMData.GetView().Num());
+
+	const double FinalizeStartTime = FPlatformTime::Seconds();
+
 	UImportedSoundWave* SoundWaveRef = CreateImportedSoundWave();
 
 	if (SoundWaveRef == nullptr)
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while creating the imported sound wave"));
-		OnResult_Internal(nullptr, ETranscodingStatus::SoundWaveDeclarationError);
+		OnResult_Internal(nullptr, ETranscodingStatus::SoundWaveDeclarationError, TimingReport);
 		return;
 	}
 
+	// Set before filling in the PCM data, so that the memory manager already sees the sound wave as evictable
+	SoundWaveRef->EncodedAudioSource = EncodedAudioSource;
+
 	DefineSoundWave(SoundWaveRef, DecodedAudioInfo);
 
+	{
+		TimingReport.FinalizeTime = FPlatformTime::Seconds() - FinalizeStartTime;
+		TimingReport.OutputSize = DecodedAudioInfo.PCMInfo.PCMData.GetView().Num();
+		TimingReport.UpdatePeakAllocationSize(TimingReport.OutputSize);
+		TimingReport.Duration = DecodedAudioInfo.SoundWaveBasicInfo.Duration;
+	}
+
 	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("The audio data was successfully imported. Information about imported data:\n%s"), *DecodedAudioInfo.ToString());
 	OnProgress_Internal(100);
-	OnResult_Internal(SoundWaveRef, ETranscodingStatus::SuccessfulImport);
+	OnResult_Internal(SoundWaveRef, ETranscodingStatus::SuccessfulImport, TimingReport);
 }
 
 void URuntimeAudioImporterLibrary::DefineSoundWave(UImportedSoundWave* SoundWaveRef, const FDecodedAudioStruct& DecodedAudioInfo)
 {
-	OnProgress_Internal(70);
-
 	// Filling in a sound wave basic information (e.g. duration, number of channels, etc)
 	FillSoundWaveBasicInfo(SoundWaveRef, DecodedAudioInfo);
 
-	OnProgress_Internal(75);
-
 	// Filling in PCM data buffer
 	FillPCMData(SoundWaveRef, DecodedAudioInfo);
 
-	OnProgress_Internal(95);
+	// Filling in the data precomputed during import (e.g. spectrogram)
+	FillAnalysisData(SoundWaveRef, DecodedAudioInfo);
 }
 
 void URuntimeAudioImporterLibrary::FillSoundWaveBasicInfo(UImportedSoundWave* SoundWaveRef, const FDecodedAudioStruct& DecodedAudioInfo)
@@ -363,6 +626,52 @@ void URuntimeAudioImporterLibrary::FillPCMData(UImportedSoundWave* SoundWaveRef,
 {
 	SoundWaveRef->PCMBufferInfo = DecodedAudioInfo.PCMInfo;
 	SoundWaveRef->RawPCMDataSize = DecodedAudioInfo.PCMInfo.PCMData.GetView().Num();
+
+	// Tracking the PCM data, which may evict the PCM data of other sound waves to fit the memory budget. The sound wave counts as just used, so it is not the first to be evicted
+	SoundWaveRef->MarkAsUsed();
+	FImportedAudioMemoryManager::Get().Register(SoundWaveRef);
+
+	// The loop points refer to the frames of the PCM data, so they are applied together with it
+	if (DecodedAudioInfo.LoopRegion.IsSet())
+	{
+		SoundWaveRef->SetLoopRegionFrames(DecodedAudioInfo.LoopRegion->StartFrame, DecodedAudioInfo.LoopRegion->EndFrame);
+	}
+}
+
+void URuntimeAudioImporterLibrary::FillAnalysisData(UImportedSoundWave* SoundWaveRef, const FDecodedAudioStruct& DecodedAudioInfo)
+{
+	SoundWaveRef->SpectrogramInfo = DecodedAudioInfo.SpectrogramInfo;
+	SoundWaveRef->WaveformPeaksInfo = DecodedAudioInfo.WaveformPeaksInfo;
+	SoundWaveRef->LoudnessInfo = DecodedAudioInfo.LoudnessInfo;
+	SoundWaveRef->PlaybackGain = DecodedAudioInfo.PlaybackGain;
+}
+
+bool URuntimeAudioImporterLibrary::GenerateWaveformThumbnailPeaks(const FDecodedAudioStruct& DecodedAudioInfo, int32 NumOfPeaksPerChannel, TArray<FWaveformPeak>& Peaks)
+{
+	FWaveformPeaksStruct WaveformPeaks;
+
+	if (!WaveformPeaksProcessor::Generate(DecodedAudioInfo, WaveformPeaks))
+	{
+		return false;
+	}
+
+	const float* PCMData = reinterpret_cast<const float*>(DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData());
+
+	Peaks.Reset(NumOfPeaksPerChannel * WaveformPeaks.NumOfChannels);
+
+	for (uint32 ChannelIndex = 0; ChannelIndex < WaveformPeaks.NumOfChannels; ++ChannelIndex)
+	{
+		TArray<FWaveformPeak> ChannelPeaks;
+
+		if (!WaveformPeaksProcessor::GetPeaks(WaveformPeaks, PCMData, ChannelIndex, 0, WaveformPeaks.NumOfFrames, NumOfPeaksPerChannel, ChannelPeaks))
+		{
+			return false;
+		}
+
+		Peaks.Append(ChannelPeaks);
+	}
+
+	return true;
 }
 
 EAudioFormat URuntimeAudioImporterLibrary::GetAudioFormat(const FString& FilePath)
@@ -401,24 +710,22 @@ EAudioFormat URuntimeAudioImporterLibrary::GetAudioFormatAdvanced(const TArray<u
 
 EAudioFormat URuntimeAudioImporterLibrary::GetAudioFormat(const uint8* AudioData, int32 AudioDataSize)
 {
-	if (MP3Transcoder::CheckAudioFormat(AudioData, AudioDataSize))
-	{
-		return EAudioFormat::Mp3;
-	}
+	SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_Probe);
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("URuntimeAudioImporterLibrary::GetAudioFormat", AudioDataSize);
 
-	if (WAVTranscoder::CheckAudioFormat(AudioData, AudioDataSize))
+	// Probing the format recognized by its signature first, since a mismatching decoder may scan the whole audio data before giving up (e.g. MP3 looking for a frame sync)
+	const EAudioFormat SignatureAudioFormat{GetAudioFormatBySignature(AudioData, AudioDataSize)};
+	if (SignatureAudioFormat != EAudioFormat::Invalid && CheckAudioFormat(SignatureAudioFormat, AudioData, AudioDataSize))
 	{
-		return EAudioFormat::Wav;
+		return SignatureAudioFormat;
 	}
 
-	if (FlacTranscoder::CheckAudioFormat(AudioData, AudioDataSize))
+	for (const EAudioFormat AudioFormat : {EAudioFormat::Mp3, EAudioFormat::Wav, EAudioFormat::Flac, EAudioFormat::OggVorbis})
 	{
-		return EAudioFormat::Flac;
-	}
-
-	if (VorbisTranscoder::CheckAudioFormat(AudioData, AudioDataSize))
-	{
-		return EAudioFormat::OggVorbis;
+		if (AudioFormat != SignatureAudioFormat && CheckAudioFormat(AudioFormat, AudioData, AudioDataSize))
+		{
+			return AudioFormat;
+		}
 	}
 
 	UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to determine audio data format"));
@@ -427,12 +734,18 @@ EAudioFormat URuntimeAudioImporterLibrary::GetAudioFormat(const uint8* AudioData
 }
 
 void URuntimeAudioImporterLibrary::ImportAudioFromFloat32Buffer(uint8* PCMData, const int32 PCMDataSize, const int32 SampleRate, const int32 NumOfChannels)
+{
+	ResetProgress_Internal();
+	ImportAudioFromFloat32Buffer_Internal(PCMData, PCMDataSize, SampleRate, NumOfChannels, FImportTimingReport());
+}
+
+void URuntimeAudioImporterLibrary::ImportAudioFromFloat32Buffer_Internal(uint8* PCMData, int32 PCMDataSize, int32 SampleRate, int32 NumOfChannels, FImportTimingReport TimingReport)
 {
 	FDecodedAudioStruct DecodedAudioInfo;
 
 	// Filling in the required information
 	{
-		DecodedAudioInfo.PCMInfo.PCMData = FBulkDataBuffer<uint8>(PCMData, PCMDataSize);
+		DecodedAudioInfo.PCMInfo.PCMData = FSharedPCMBuffer(PCMData, PCMDataSize);
 		DecodedAudioInfo.PCMInfo.PCMNumOfFrames = PCMDataSize / sizeof(float) / NumOfChannels;
 
 		DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels = NumOfChannels;
@@ -440,10 +753,28 @@ void URuntimeAudioImporterLibrary::ImportAudioFromFloat32Buffer(uint8* PCMData,
 		DecodedAudioInfo.SoundWaveBasicInfo.Duration = static_cast<float>(DecodedAudioInfo.PCMInfo.PCMNumOfFrames) / SampleRate;
 	}
 
-	OnProgress_Internal(50);
+	OnProgress_Internal(DecodedProgressPercentage);
+
+	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [this, DecodedAudioInfo = MoveTemp(DecodedAudioInfo), ImportSettings = ImportSettings, TimingReport]() mutable
+	{
+		const double ProcessStartTime = FPlatformTime::Seconds();
+
+		if (!ProcessDecodedAudioData(DecodedAudioInfo, ImportSettings))
+		{
+			OnResult_Internal(nullptr, ETranscodingStatus::FailedToProcessAudioData, TimingReport);
+			return;
+		}
+
+		TimingReport.ProcessTime = FPlatformTime::Seconds() - ProcessStartTime;
 
-	// Finalizing import
-	ImportAudioFromDecodedInfo(DecodedAudioInfo);
+		OnProgress_Internal(ProcessedProgressPercentage);
+
+		// Finalizing import
+		AsyncTask(ENamedThreads::GameThread, [this, DecodedAudioInfo = MoveTemp(DecodedAudioInfo), TimingReport]()
+		{
+			ImportAudioFromDecodedInfo_Internal(DecodedAudioInfo, nullptr, TimingReport);
+		});
+	});
 }
 
 FString URuntimeAudioImporterLibrary::ConvertSecondsToString(int32 Seconds)
@@ -467,18 +798,52 @@ FString URuntimeAudioImporterLibrary::ConvertSecondsToString(int32 Seconds)
 	return FinalString;
 }
 
-bool URuntimeAudioImporterLibrary::DecodeAudioData(FEncodedAudioStruct& EncodedAudioInfo, FDecodedAudioStruct& DecodedAudioInfo)
+bool URuntimeAudioImporterLibrary::DecodeAudioData(FEncodedAudioStruct& EncodedAudioInfo, FDecodedAudioStruct& DecodedAudioInfo, const FOnDecodingProgress& OnDecodingProgress)
 {
 	if (EncodedAudioInfo.AudioFormat == EAudioFormat::Auto)
 	{
-		EncodedAudioInfo.AudioFormat = GetAudioFormat(EncodedAudioInfo.AudioData.GetView().GetData(), EncodedAudioInfo.AudioData.GetView().Num());
+		const uint8* AudioData = EncodedAudioInfo.AudioData.GetView().GetData();
+		const int32 AudioDataSize = EncodedAudioInfo.AudioData.GetView().Num();
+
+		// Decoding the format recognized by its signature right away, since the decoder validates the audio data anyway. Probing opens the decoder a second time
+		const EAudioFormat SignatureAudioFormat{GetAudioFormatBySignature(AudioData, AudioDataSize)};
+		if (SignatureAudioFormat != EAudioFormat::Invalid)
+		{
+			EncodedAudioInfo.AudioFormat = SignatureAudioFormat;
+
+			if (DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo, OnDecodingProgress))
+			{
+				return true;
+			}
+
+			UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("Unable to decode the audio data as '%s' recognized by its signature, probing the other formats"), *UEnum::GetValueAsName(SignatureAudioFormat).ToString());
+		}
+
+		// Probing only the remaining formats, since the decoder of the format recognized by its signature has already failed
+		EncodedAudioInfo.AudioFormat = EAudioFormat::Invalid;
+		for (const EAudioFormat CandidateAudioFormat : {EAudioFormat::Mp3, EAudioFormat::Wav, EAudioFormat::Flac, EAudioFormat::OggVorbis})
+		{
+			if (CandidateAudioFormat != SignatureAudioFormat && CheckAudioFormat(CandidateAudioFormat, AudioData, AudioDataSize))
+			{
+				EncodedAudioInfo.AudioFormat = CandidateAudioFormat;
+				break;
+			}
+		}
+
+		if (EncodedAudioInfo.AudioFormat == EAudioFormat::Invalid)
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to determine audio data format for decoding"));
+			return false;
+		}
 	}
 
 	switch (EncodedAudioInfo.AudioFormat)
 	{
 	case EAudioFormat::Mp3:
 		{
-			if (!MP3Transcoder::Decode(EncodedAudioInfo, DecodedAudioInfo))
+			SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_DecodeMp3);
+
+			if (!MP3Transcoder::Decode(EncodedAudioInfo, DecodedAudioInfo, OnDecodingProgress))
 			{
 				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while decoding Mp3 audio data"));
 				return false;
@@ -487,7 +852,9 @@ bool URuntimeAudioImporterLibrary::DecodeAudioData(FEncodedAudioStruct& EncodedA
 		}
 	case EAudioFormat::Wav:
 		{
-			if (!WAVTranscoder::Decode(EncodedAudioInfo, DecodedAudioInfo))
+			SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_DecodeWav);
+
+			if (!WAVTranscoder::Decode(EncodedAudioInfo, DecodedAudioInfo, OnDecodingProgress))
 			{
 				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while decoding Wav audio data"));
 				return false;
@@ -496,7 +863,9 @@ bool URuntimeAudioImporterLibrary::DecodeAudioData(FEncodedAudioStruct& EncodedA
 		}
 	case EAudioFormat::Flac:
 		{
-			if (!FlacTranscoder::Decode(EncodedAudioInfo, DecodedAudioInfo))
+			SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_DecodeFlac);
+
+			if (!FlacTranscoder::Decode(EncodedAudioInfo, DecodedAudioInfo, OnDecodingProgress))
 			{
 				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while decoding Flac audio data"));
 				return false;
@@ -505,7 +874,9 @@ bool URuntimeAudioImporterLibrary::DecodeAudioData(FEncodedAudioStruct& EncodedA
 		}
 	case EAudioFormat::OggVorbis:
 		{
-			if (!VorbisTranscoder::Decode(EncodedAudioInfo, DecodedAudioInfo))
+			SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_DecodeVorbis);
+
+			if (!VorbisTranscoder::Decode(EncodedAudioInfo, DecodedAudioInfo, OnDecodingProgress))
 			{
 				UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while decoding Vorbis audio data"));
 				return false;
@@ -522,8 +893,156 @@ bool URuntimeAudioImporterLibrary::DecodeAudioData(FEncodedAudioStruct& EncodedA
 	return true;
 }
 
+bool URuntimeAudioImporterLibrary::GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, EAudioFormat& AudioFormat, FSoundWaveBasicStruct& BasicInfo)
+{
+	if (AudioFormat == EAudioFormat::Auto)
+	{
+		// Reading the headers with the decoder of each candidate format directly, since probing the format first would open the matching decoder twice
+		const EAudioFormat SignatureAudioFormat{GetAudioFormatBySignature(AudioData, AudioDataSize)};
+		if (SignatureAudioFormat != EAudioFormat::Invalid && GetAudioInfoByFormat(SignatureAudioFormat, AudioData, AudioDataSize, BasicInfo))
+		{
+			AudioFormat = SignatureAudioFormat;
+			return true;
+		}
+
+		for (const EAudioFormat CandidateAudioFormat : {EAudioFormat::Mp3, EAudioFormat::Wav, EAudioFormat::Flac, EAudioFormat::OggVorbis})
+		{
+			if (CandidateAudioFormat != SignatureAudioFormat && GetAudioInfoByFormat(CandidateAudioFormat, AudioData, AudioDataSize, BasicInfo))
+			{
+				AudioFormat = CandidateAudioFormat;
+				return true;
+			}
+		}
+
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to determine audio data format for getting the audio information"));
+		AudioFormat = EAudioFormat::Invalid;
+		return false;
+	}
+
+	if (!GetAudioInfoByFormat(AudioFormat, AudioData, AudioDataSize, BasicInfo))
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Unable to get the audio information of '%s' audio data"), *UEnum::GetValueAsName(AudioFormat).ToString());
+		return false;
+	}
+
+	return true;
+}
+
+bool URuntimeAudioImporterLibrary::ProcessDecodedAudioData(FDecodedAudioStruct& DecodedAudioInfo, const FAudioImportSettings& ImportSettings)
+{
+	SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_Process);
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("URuntimeAudioImporterLibrary::ProcessDecodedAudioData", DecodedAudioInfo.PCMInfo.PCMData.GetView().Num());
+
+	// Dropping the unused loop region first, so that the following stages do not need to keep it in sync
+	if (!ImportSettings.bUseEmbeddedLoopRegion)
+	{
+		DecodedAudioInfo.LoopRegion.Reset();
+	}
+
+	// Remixing channels first, so that the following stages process less data
+	if (!ChannelMixProcessor::Remix(DecodedAudioInfo, ImportSettings.ChannelRemixMode, ImportSettings.ExtractedChannelIndex))
+	{
+		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while remixing audio data channels"));
+		return false;
+	}
+
+	// Converting to the target sample rate once, so the mixer does not need to resample the sound wave during playback
+	if (ImportSettings.TargetSampleRate > 0 && DecodedAudioInfo.SoundWaveBasicInfo.SampleRate != static_cast<uint32>(ImportSettings.TargetSampleRate))
+	{
+		if (!ResampleProcessor::Resample(DecodedAudioInfo, ImportSettings.TargetSampleRate, ImportSettings.ResamplingQuality))
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while resampling audio data"));
+			return false;
+		}
+	}
+
+	// Trimming the leading and trailing silence before the analysis stages, so that their timeline matches the playback one
+	if (ImportSettings.bTrimSilence)
+	{
+		if (!SilenceProcessor::TrimEdges(DecodedAudioInfo, ImportSettings.SilenceThreshold))
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while trimming silence"));
+			return false;
+		}
+	}
+
+	// Measuring loudness before the analysis stages, so that they see the audio data with the baked gain
+	if (ImportSettings.bAnalyzeLoudness)
+	{
+		FLoudnessInfo LoudnessInfo;
+
+		if (!LoudnessProcessor::Analyze(DecodedAudioInfo, ImportSettings.TargetLoudness, ImportSettings.MaxTruePeak, LoudnessInfo))
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while analyzing loudness"));
+			return false;
+		}
+
+		switch (ImportSettings.LoudnessNormalization)
+		{
+		case ELoudnessNormalization::ApplyOnPlayback:
+			{
+				DecodedAudioInfo.PlaybackGain = LoudnessInfo.NormalizationGain;
+				break;
+			}
+		case ELoudnessNormalization::BakeIntoAudioData:
+			{
+				LoudnessProcessor::ApplyGain(DecodedAudioInfo, LoudnessInfo.NormalizationGain);
+				break;
+			}
+		default:
+			{
+				break;
+			}
+		}
+
+		DecodedAudioInfo.LoudnessInfo = LoudnessInfo;
+	}
+
+	// Precomputing the spectrogram of the final audio data, so that visualization becomes a lookup
+	if (ImportSettings.bGenerateSpectrogram)
+	{
+		TSharedRef<FSpectrogramStruct, ESPMode::ThreadSafe> Spectrogram = MakeShared<FSpectrogramStruct, ESPMode::ThreadSafe>();
+
+		if (!SpectrogramProcessor::Generate(DecodedAudioInfo, FMath::Max(ImportSettings.SpectrogramFFTSize, 0), FMath::Max(ImportSettings.SpectrogramHopSize, 0), Spectrogram.Get()))
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while generating the spectrogram"));
+			return false;
+		}
+
+		DecodedAudioInfo.SpectrogramInfo = Spectrogram;
+	}
+
+	// Precomputing the waveform peak pyramid, so that drawing the waveform at any zoom level does not need to scan the audio data
+	if (ImportSettings.bGenerateWaveformPeaks)
+	{
+		TSharedRef<FWaveformPeaksStruct, ESPMode::ThreadSafe> WaveformPeaks = MakeShared<FWaveformPeaksStruct, ESPMode::ThreadSafe>();
+
+		if (!WaveformPeaksProcessor::Generate(DecodedAudioInfo, WaveformPeaks.Get()))
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while generating the waveform peaks"));
+			return false;
+		}
+
+		DecodedAudioInfo.WaveformPeaksInfo = WaveformPeaks;
+	}
+
+	// Removing internal silence from the stored data last, since the other stages expect all frames to be stored
+	if (ImportSettings.bTrimSilence)
+	{
+		if (!SilenceProcessor::CompactSilence(DecodedAudioInfo, ImportSettings.SilenceThreshold, ImportSettings.MinSilenceDuration))
+		{
+			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Something went wrong while compacting silence"));
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool URuntimeAudioImporterLibrary::EncodeAudioData(const FDecodedAudioStruct& DecodedAudioInfo, FEncodedAudioStruct& EncodedAudioInfo, uint8 Quality)
 {
+	SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_Encode);
+
 	if (EncodedAudioInfo.AudioFormat == EAudioFormat::Auto || EncodedAudioInfo.AudioFormat == EAudioFormat::Invalid)
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("Undefined audio data format for encoding"));
@@ -577,24 +1096,106 @@ UImportedSoundWave* URuntimeAudioImporterLibrary::CreateImportedSoundWave() cons
 
 void URuntimeAudioImporterLibrary::OnProgress_Internal(int32 Percentage)
 {
-	AsyncTask(ENamedThreads::GameThread, [this, Percentage]()
+	ProgressPercentage = Percentage;
+
+	// A scheduled ticker picks up the latest percentage by itself, so there is nothing else to do
+	if (bProgressDispatchPending.Exchange(true))
 	{
-		if (OnProgress.IsBound())
-		{
-			OnProgress.Broadcast(Percentage);
-		}
+		return;
+	}
 
-		if (OnProgressNative.IsBound())
+	// Tickers can only be registered on the game thread
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this)]()
+	{
+		const FTickerDelegate TickerDelegate = FTickerDelegate::CreateLambda([WeakThis](float DeltaTime)
 		{
-			OnProgressNative.Broadcast(Percentage);
-		}
+			return WeakThis.IsValid() && WeakThis->TickProgress_Internal();
+		});
+
+#if ENGINE_MAJOR_VERSION < 5
+		FTicker::GetCoreTicker().AddTicker(TickerDelegate);
+#else
+		FTSTicker::GetCoreTicker().AddTicker(TickerDelegate);
+#endif
 	});
 }
 
-void URuntimeAudioImporterLibrary::OnResult_Internal(UImportedSoundWave* SoundWaveRef, ETranscodingStatus Status)
+bool URuntimeAudioImporterLibrary::BroadcastProgress_Internal()
 {
-	AsyncTask(ENamedThreads::GameThread, [this, SoundWaveRef, Status]()
+	const int32 Percentage = ProgressPercentage;
+
+	if (Percentage == LastBroadcastProgressPercentage)
+	{
+		return false;
+	}
+
+	LastBroadcastProgressPercentage = Percentage;
+
+	if (OnProgress.IsBound())
 	{
+		OnProgress.Broadcast(Percentage);
+	}
+
+	if (OnProgressNative.IsBound())
+	{
+		OnProgressNative.Broadcast(Percentage);
+	}
+
+	return true;
+}
+
+void URuntimeAudioImporterLibrary::ResetProgress_Internal()
+{
+	ProgressPercentage = 0;
+
+	// The last broadcast percentage is only accessed on the game thread. The reset is queued ahead of the game thread dispatch of the first progress of the import
+	if (IsInGameThread())
+	{
+		LastBroadcastProgressPercentage = INDEX_NONE;
+	}
+	else
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = MakeWeakObjectPtr(this)]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->LastBroadcastProgressPercentage = INDEX_NONE;
+			}
+		});
+	}
+}
+
+bool URuntimeAudioImporterLibrary::TickProgress_Internal()
+{
+	if (BroadcastProgress_Internal())
+	{
+		return true;
+	}
+
+	// The progress did not change during the last tick, so the ticker is removed
+	bProgressDispatchPending = false;
+
+	// The progress may have changed after the check above without scheduling a new ticker, in which case this one keeps ticking
+	return ProgressPercentage != LastBroadcastProgressPercentage && !bProgressDispatchPending.Exchange(true);
+}
+
+void URuntimeAudioImporterLibrary::OnResult_Internal(UImportedSoundWave* SoundWaveRef, ETranscodingStatus Status, FImportTimingReport TimingReport)
+{
+	TimingReport.TotalTime = FPlatformTime::Seconds() - TimingReport.StartTime;
+	TimingReport.UpdateThroughput();
+
+	UE_LOG(LogRuntimeAudioImporter, Log, TEXT("Import timings: %s"), *TimingReport.ToString());
+
+	if (Status == ETranscodingStatus::SuccessfulImport && MinImportThroughput > 0.f && TimingReport.Throughput > 0.f && TimingReport.Throughput < MinImportThroughput)
+	{
+		UE_LOG(LogRuntimeAudioImporter, Warning, TEXT("The import throughput '%fx' is below the expected minimum of '%fx'"), TimingReport.Throughput, MinImportThroughput);
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [this, SoundWaveRef, Status, TimingReport]()
+	{
+		// Broadcasting the pending progress first, so that it never arrives after the result
+		BroadcastProgress_Internal();
+
 		bool bBroadcasted{false};
 
 		if (OnResultNative.IsBound())
@@ -609,6 +1210,18 @@ void URuntimeAudioImporterLibrary::OnResult_Internal(UImportedSoundWave* SoundWa
 			OnResult.Broadcast(this, SoundWaveRef, Status);
 		}
 
+		if (OnResultWithTimingReportNative.IsBound())
+		{
+			bBroadcasted = true;
+			OnResultWithTimingReportNative.Broadcast(this, SoundWaveRef, Status, TimingReport);
+		}
+
+		if (OnResultWithTimingReport.IsBound())
+		{
+			bBroadcasted = true;
+			OnResultWithTimingReport.Broadcast(this, SoundWaveRef, Status, TimingReport);
+		}
+
 		if (!bBroadcasted)
 		{
 			UE_LOG(LogRuntimeAudioImporter, Error, TEXT("You did not bind to the delegate to get the result of the import"));
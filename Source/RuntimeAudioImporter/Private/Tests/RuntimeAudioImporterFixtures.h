@@ -0,0 +1,365 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Synthesis of the audio data used by the automation tests and the standalone benchmark
+ * The audio data is written to memory provided by the caller and only the basic engine types are used, so that it builds both with the engine and with the benchmark shim
+ */
+namespace RuntimeAudioImporter_Fixtures
+{
+	/** Number of frames per block of the synthesized FLAC audio data */
+	constexpr uint32 FlacBlockSize = 4096;
+
+	/** Size of a synthesized MPEG-1 Layer III frame at 128 kbps and 44100 Hz, in bytes */
+	constexpr uint32 MP3FrameSize = 417;
+
+	/** Number of frames per MPEG-1 Layer III frame */
+	constexpr uint32 MP3FrameNumOfFrames = 1152;
+
+	/** Number of spectral lines per granule carrying the synthesized MP3 content, out of 576 */
+	constexpr uint32 MP3NumOfCodedLines = 128;
+
+	/** Global gain of the synthesized MP3 content, a quantized value of 1 being requantized to 2^((MP3GlobalGain - 210) / 4) */
+	constexpr uint32 MP3GlobalGain = 190;
+
+	/**
+	 * Get a sample of the test signal, made of a different sine tone per channel and quantized to 16 bits so that the lossless formats reproduce it exactly
+	 */
+	inline float GetSignalSample(uint32 ChannelIndex, uint32 FrameIndex, uint32 SampleRate)
+	{
+		const double Frequency = 440. * (ChannelIndex + 1);
+		const double Sample = 0.5 * FMath::Sin(2. * PI * Frequency * FrameIndex / SampleRate);
+
+		return FMath::RoundToInt(Sample * 32767.) / 32768.f;
+	}
+
+	/** Big-endian bit writer used to synthesize FLAC and MP3 audio data */
+	class FBitWriter
+	{
+	public:
+		explicit FBitWriter(uint8* InData)
+			: Data(InData)
+		{
+		}
+
+		void WriteBits(uint64 Value, int32 NumOfBits)
+		{
+			for (int32 BitIndex = NumOfBits - 1; BitIndex >= 0; --BitIndex)
+			{
+				if (NumOfPendingBits == 0)
+				{
+					Data[NumOfBytes++] = 0;
+				}
+
+				Data[NumOfBytes - 1] |= ((Value >> BitIndex) & 1) << (7 - NumOfPendingBits);
+				NumOfPendingBits = (NumOfPendingBits + 1) % 8;
+			}
+		}
+
+		/** Number of bytes written so far, including the partially written one */
+		uint64 GetNumOfBytes() const
+		{
+			return NumOfBytes;
+		}
+
+		/** Number of bits written so far */
+		uint64 GetNumOfBits() const
+		{
+			return NumOfBytes * 8 - (NumOfPendingBits == 0 ? 0 : 8 - NumOfPendingBits);
+		}
+
+	private:
+		uint8* Data;
+		uint64 NumOfBytes = 0;
+		int32 NumOfPendingBits = 0;
+	};
+
+	/**
+	 * Compute the CRC-8 of a FLAC frame header (polynomial 0x07)
+	 */
+	inline uint8 ComputeFlacCRC8(const uint8* Data, uint64 Size)
+	{
+		uint8 CRC = 0;
+
+		for (uint64 Index = 0; Index < Size; ++Index)
+		{
+			CRC ^= Data[Index];
+			for (int32 BitIndex = 0; BitIndex < 8; ++BitIndex)
+			{
+				CRC = (CRC & 0x80) ? static_cast<uint8>((CRC << 1) ^ 0x07) : static_cast<uint8>(CRC << 1);
+			}
+		}
+
+		return CRC;
+	}
+
+	/**
+	 * Compute the CRC-16 of a FLAC frame (polynomial 0x8005)
+	 */
+	inline uint16 ComputeFlacCRC16(const uint8* Data, uint64 Size)
+	{
+		uint16 CRC = 0;
+
+		for (uint64 Index = 0; Index < Size; ++Index)
+		{
+			CRC ^= static_cast<uint16>(Data[Index]) << 8;
+			for (int32 BitIndex = 0; BitIndex < 8; ++BitIndex)
+			{
+				CRC = (CRC & 0x8000) ? static_cast<uint16>((CRC << 1) ^ 0x8005) : static_cast<uint16>(CRC << 1);
+			}
+		}
+
+		return CRC;
+	}
+
+	/**
+	 * Get the size of the FLAC audio data synthesized by SynthesizeFlac, in bytes
+	 */
+	inline uint64 GetFlacSize(uint32 NumOfChannels, uint32 NumOfFrames)
+	{
+		// Signature, STREAMINFO block header and STREAMINFO
+		uint64 Size = 4 + 4 + 34;
+
+		for (uint32 FrameNumber = 0; static_cast<uint64>(FrameNumber) * FlacBlockSize < NumOfFrames; ++FrameNumber)
+		{
+			const uint32 BlockSize = FMath::Min(FlacBlockSize, NumOfFrames - FrameNumber * FlacBlockSize);
+			const uint32 FrameNumberSize = FrameNumber < 0x80 ? 1 : FrameNumber < 0x800 ? 2 : 3;
+
+			// Frame header with its CRC-8, a verbatim subframe per channel and the CRC-16
+			Size += 4 + FrameNumberSize + 2 + 1 + NumOfChannels * (1 + static_cast<uint64>(BlockSize) * 2) + 2;
+		}
+
+		return Size;
+	}
+
+	/**
+	 * Synthesize 16-bit FLAC audio data made of verbatim subframes. The plugin has no FLAC encoder, and verbatim subframes exercise the whole frame parsing of the decoder
+	 *
+	 * @param Signal Interleaved 32-bit float PCM data quantized to 16 bits
+	 * @param NumOfChannels Number of channels
+	 * @param NumOfFrames Number of frames
+	 * @param SampleRate Sample rate
+	 * @param OutData Memory with room for GetFlacSize bytes
+	 * @return Number of bytes written
+	 */
+	inline uint64 SynthesizeFlac(const float* Signal, uint32 NumOfChannels, uint32 NumOfFrames, uint32 SampleRate, uint8* OutData)
+	{
+		FBitWriter Writer(OutData);
+
+		Writer.WriteBits(0x664C6143, 32);
+
+		// The STREAMINFO block is the last metadata block, with an unknown MD5 signature
+		{
+			Writer.WriteBits(1, 1);
+			Writer.WriteBits(0, 7);
+			Writer.WriteBits(34, 24);
+
+			Writer.WriteBits(FlacBlockSize, 16);
+			Writer.WriteBits(FlacBlockSize, 16);
+			Writer.WriteBits(0, 24);
+			Writer.WriteBits(0, 24);
+			Writer.WriteBits(SampleRate, 20);
+			Writer.WriteBits(NumOfChannels - 1, 3);
+			Writer.WriteBits(16 - 1, 5);
+			Writer.WriteBits(NumOfFrames, 36);
+			Writer.WriteBits(0, 64);
+			Writer.WriteBits(0, 64);
+		}
+
+		for (uint32 FrameNumber = 0; static_cast<uint64>(FrameNumber) * FlacBlockSize < NumOfFrames; ++FrameNumber)
+		{
+			const uint32 BlockStartFrame = FrameNumber * FlacBlockSize;
+			const uint32 BlockSize = FMath::Min(FlacBlockSize, NumOfFrames - BlockStartFrame);
+			const uint64 FrameStart = Writer.GetNumOfBytes();
+
+			// Sync code, fixed block size strategy
+			Writer.WriteBits(0x3FFE, 14);
+			Writer.WriteBits(0, 2);
+
+			// Block size stored at the end of the header, sample rate from STREAMINFO, independent channels, 16 bits per sample
+			Writer.WriteBits(0x7, 4);
+			Writer.WriteBits(0x0, 4);
+			Writer.WriteBits(NumOfChannels - 1, 4);
+			Writer.WriteBits(0x4, 3);
+			Writer.WriteBits(0, 1);
+
+			// Frame number, UTF-8 coded
+			if (FrameNumber < 0x80)
+			{
+				Writer.WriteBits(FrameNumber, 8);
+			}
+			else if (FrameNumber < 0x800)
+			{
+				Writer.WriteBits(0xC0 | (FrameNumber >> 6), 8);
+				Writer.WriteBits(0x80 | (FrameNumber & 0x3F), 8);
+			}
+			else
+			{
+				Writer.WriteBits(0xE0 | (FrameNumber >> 12), 8);
+				Writer.WriteBits(0x80 | ((FrameNumber >> 6) & 0x3F), 8);
+				Writer.WriteBits(0x80 | (FrameNumber & 0x3F), 8);
+			}
+
+			Writer.WriteBits(BlockSize - 1, 16);
+			Writer.WriteBits(ComputeFlacCRC8(OutData + FrameStart, Writer.GetNumOfBytes() - FrameStart), 8);
+
+			for (uint32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+			{
+				// Verbatim subframe without wasted bits
+				Writer.WriteBits(0x02, 8);
+
+				for (uint32 FrameIndex = BlockStartFrame; FrameIndex < BlockStartFrame + BlockSize; ++FrameIndex)
+				{
+					const int32 Sample = FMath::RoundToInt(Signal[static_cast<uint64>(FrameIndex) * NumOfChannels + ChannelIndex] * 32768.f);
+					Writer.WriteBits(static_cast<uint16>(static_cast<int16>(Sample)), 16);
+				}
+			}
+
+			Writer.WriteBits(ComputeFlacCRC16(OutData + FrameStart, Writer.GetNumOfBytes() - FrameStart), 16);
+		}
+
+		return Writer.GetNumOfBytes();
+	}
+
+	/**
+	 * Get the size of the MP3 audio data synthesized by SynthesizeMP3, in bytes
+	 */
+	inline uint64 GetMP3Size(uint32 NumOfFrames)
+	{
+		return static_cast<uint64>((NumOfFrames + MP3FrameNumOfFrames - 1) / MP3FrameNumOfFrames) * MP3FrameSize;
+	}
+
+	/**
+	 * Get a quantized spectral value of the synthesized MP3 audio data, a sparse pattern of -1, 0 and 1 that moves from frame to frame
+	 */
+	inline int32 GetMP3SpectralValue(uint32 LineIndex, uint32 GranuleIndex, uint32 ChannelIndex, uint64 MP3FrameIndex)
+	{
+		if ((LineIndex + 3 * GranuleIndex + 5 * ChannelIndex + MP3FrameIndex) % 11 != 0)
+		{
+			return 0;
+		}
+
+		return ((LineIndex + MP3FrameIndex) & 1) ? -1 : 1;
+	}
+
+	/**
+	 * Write the Huffman-coded spectral values of a granule of a channel. The first half of MP3NumOfCodedLines is coded as big values with table 1, the second half as count1 quadruples with table B
+	 */
+	inline void WriteMP3SpectralData(FBitWriter& Writer, uint32 GranuleIndex, uint32 ChannelIndex, uint64 MP3FrameIndex)
+	{
+		// Table 1 codewords, indexed by 2 * |x| + |y|
+		constexpr uint8 BigValuesCodes[] = {0x1, 0x1, 0x1, 0x0};
+		constexpr int32 BigValuesCodeLengths[] = {1, 3, 2, 3};
+
+		for (uint32 LineIndex = 0; LineIndex < MP3NumOfCodedLines / 2; LineIndex += 2)
+		{
+			const int32 X = GetMP3SpectralValue(LineIndex, GranuleIndex, ChannelIndex, MP3FrameIndex);
+			const int32 Y = GetMP3SpectralValue(LineIndex + 1, GranuleIndex, ChannelIndex, MP3FrameIndex);
+			const int32 CodeIndex = 2 * (X != 0) + (Y != 0);
+
+			Writer.WriteBits(BigValuesCodes[CodeIndex], BigValuesCodeLengths[CodeIndex]);
+			if (X != 0)
+			{
+				Writer.WriteBits(X < 0, 1);
+			}
+			if (Y != 0)
+			{
+				Writer.WriteBits(Y < 0, 1);
+			}
+		}
+
+		for (uint32 LineIndex = MP3NumOfCodedLines / 2; LineIndex < MP3NumOfCodedLines; LineIndex += 4)
+		{
+			int32 Values[4];
+			uint32 Quadruple = 0;
+			for (uint32 ValueIndex = 0; ValueIndex < 4; ++ValueIndex)
+			{
+				Values[ValueIndex] = GetMP3SpectralValue(LineIndex + ValueIndex, GranuleIndex, ChannelIndex, MP3FrameIndex);
+				Quadruple = (Quadruple << 1) | (Values[ValueIndex] != 0);
+			}
+
+			// Table B codewords are the inverted quadruple
+			Writer.WriteBits(~Quadruple & 0xF, 4);
+			for (const int32 Value : Values)
+			{
+				if (Value != 0)
+				{
+					Writer.WriteBits(Value < 0, 1);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Synthesize MP3 audio data made of MPEG-1 Layer III frames at 128 kbps. The plugin has no MP3 encoder, so the frames carry Huffman-coded spectral values written directly,
+	 * which makes the decoder go through Huffman decoding, requantization, the IMDCT and the synthesis filterbank
+	 *
+	 * @param NumOfChannels Number of channels, either 1 or 2
+	 * @param NumOfFrames Number of frames, rounded up to whole MP3 frames
+	 * @param OutData Memory with room for GetMP3Size bytes
+	 */
+	inline void SynthesizeMP3(uint32 NumOfChannels, uint32 NumOfFrames, uint8* OutData)
+	{
+		const uint64 AudioDataSize = GetMP3Size(NumOfFrames);
+		const uint32 SideInfoSize = NumOfChannels == 1 ? 17 : 32;
+		FMemory::Memset(OutData, 0, AudioDataSize);
+
+		for (uint64 MP3FrameIndex = 0; MP3FrameIndex < AudioDataSize / MP3FrameSize; ++MP3FrameIndex)
+		{
+			uint8* Header = OutData + MP3FrameIndex * MP3FrameSize;
+
+			// Frame sync, MPEG-1, Layer III, no CRC, 128 kbps, 44100 Hz, no padding, stereo or mono
+			Header[0] = 0xFF;
+			Header[1] = 0xFB;
+			Header[2] = 0x90;
+			Header[3] = NumOfChannels == 1 ? 0xC0 : 0x00;
+
+			// The main data follows the side information without using the bit reservoir, and carries no scalefactors
+			uint32 Part23Lengths[2][2];
+			{
+				FBitWriter MainDataWriter(Header + 4 + SideInfoSize);
+				for (uint32 GranuleIndex = 0; GranuleIndex < 2; ++GranuleIndex)
+				{
+					for (uint32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+					{
+						const uint64 StartBit = MainDataWriter.GetNumOfBits();
+						WriteMP3SpectralData(MainDataWriter, GranuleIndex, ChannelIndex, MP3FrameIndex);
+						Part23Lengths[GranuleIndex][ChannelIndex] = static_cast<uint32>(MainDataWriter.GetNumOfBits() - StartBit);
+					}
+				}
+			}
+
+			FBitWriter SideInfoWriter(Header + 4);
+			SideInfoWriter.WriteBits(0, 9);
+			SideInfoWriter.WriteBits(0, NumOfChannels == 1 ? 5 : 3);
+			SideInfoWriter.WriteBits(0, 4 * NumOfChannels);
+
+			for (uint32 GranuleIndex = 0; GranuleIndex < 2; ++GranuleIndex)
+			{
+				for (uint32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+				{
+					SideInfoWriter.WriteBits(Part23Lengths[GranuleIndex][ChannelIndex], 12);
+					SideInfoWriter.WriteBits(MP3NumOfCodedLines / 4, 9);
+					SideInfoWriter.WriteBits(MP3GlobalGain, 8);
+
+					// No scalefactor bits, long blocks, table 1 in every region
+					SideInfoWriter.WriteBits(0, 4);
+					SideInfoWriter.WriteBits(0, 1);
+					SideInfoWriter.WriteBits(1, 5);
+					SideInfoWriter.WriteBits(1, 5);
+					SideInfoWriter.WriteBits(1, 5);
+					SideInfoWriter.WriteBits(7, 4);
+					SideInfoWriter.WriteBits(7, 3);
+
+					// No preemphasis, default scalefactor scale, count1 table B
+					SideInfoWriter.WriteBits(0, 1);
+					SideInfoWriter.WriteBits(0, 1);
+					SideInfoWriter.WriteBits(1, 1);
+				}
+			}
+		}
+	}
+}
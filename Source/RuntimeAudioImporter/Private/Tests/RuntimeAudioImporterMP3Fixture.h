@@ -0,0 +1,179 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * MP3 fixture checked in together with its stored decode, so that a change in the decoding of MP3 audio data is caught even if the synthesis of the fixtures changes with it
+ */
+namespace RuntimeAudioImporter_Fixtures
+{
+	/** Number of channels of the MP3 fixture */
+	constexpr uint32 MP3FixtureNumOfChannels = 2;
+
+	/** Number of frames of the MP3 fixture, once decoded */
+	constexpr uint32 MP3FixtureNumOfFrames = 4608;
+
+	/** Sample rate of the MP3 fixture */
+	constexpr uint32 MP3FixtureSampleRate = 44100;
+
+	/**
+	 * Four stereo MPEG-1 Layer III frames at 128 kbps and 44100 Hz, as written by SynthesizeMP3
+	 */
+	const uint8 MP3Fixture[] = {
+		0xFF, 0xFB, 0x90, 0x00, 0x00, 0x00, 0x00, 0x75, 0x10, 0x5F, 0x00, 0x21, 0x0B, 0xF2, 0x0E, 0xA2,
+		0x0B, 0xE0, 0x04, 0x21, 0x7E, 0x41, 0xD0, 0x41, 0x7C, 0x00, 0x84, 0x2F, 0xC8, 0x3A, 0x88, 0x2F,
+		0x80, 0x10, 0x85, 0xF9, 0x5E, 0x7F, 0x5E, 0x7F, 0x5E, 0x7F, 0xAF, 0xFB, 0xFF, 0xBB, 0xFB, 0xFF,
+		0xAF, 0xFB, 0xFF, 0x5E, 0x7F, 0x5E, 0x7F, 0x5E, 0x7F, 0xF7, 0x7F, 0x7F, 0xF5, 0xFF, 0x7F, 0xF7,
+		0x7F, 0x7D, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFF, 0xEB, 0xFE, 0xFF, 0xEE, 0xFE, 0xFF, 0xEB, 0xFE,
+		0x7F, 0x5E, 0x7F, 0x5E, 0x7F, 0x5F, 0xDF, 0xFD, 0xDF, 0xDF, 0xFD, 0x7F, 0xDF, 0xFD, 0xC0, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xFB, 0x90, 0x00, 0x00, 0x00, 0x00, 0x72, 0x10, 0x5F, 0x00, 0x21, 0x0B, 0xF2, 0x0E,
+		0xA2, 0x0B, 0xE0, 0x04, 0x21, 0x7E, 0x41, 0xD0, 0x41, 0x7C, 0x00, 0x84, 0x2F, 0xC8, 0x3A, 0x88,
+		0x2F, 0x80, 0x10, 0x85, 0xF9, 0xFB, 0xF2, 0xFB, 0xF2, 0xFB, 0xFB, 0x7F, 0xBF, 0xF9, 0xFF, 0xBF,
+		0xFB, 0x7F, 0xBF, 0xF2, 0xFB, 0xF2, 0xFB, 0xF2, 0xFB, 0xFF, 0x3F, 0xF7, 0xFF, 0x6F, 0xF7, 0xFF,
+		0x3F, 0xF7, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xFE, 0xDF, 0xEF, 0xFE, 0x7F, 0xEF, 0xFE, 0xDF,
+		0xF7, 0xE5, 0xF7, 0xE5, 0xF7, 0xE5, 0xFD, 0xFF, 0xCF, 0xFD, 0xFF, 0xDB, 0xFD, 0xFF, 0xCF, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFB, 0x90, 0x00, 0x00, 0x00, 0x00, 0x73, 0x10, 0x5F, 0x00, 0x21, 0x0B, 0xF2,
+		0x0E, 0xA2, 0x0B, 0xE0, 0x04, 0x21, 0x7E, 0x41, 0xD4, 0x41, 0x7C, 0x00, 0x84, 0x2F, 0xC8, 0x3A,
+		0x88, 0x2F, 0x80, 0x10, 0x85, 0xF9, 0xF3, 0xFA, 0xF3, 0xFA, 0xF3, 0xFB, 0xBF, 0xBF, 0xFA, 0xFF,
+		0xBF, 0xFB, 0xBF, 0xBF, 0xFA, 0xF3, 0xFA, 0xF3, 0xFA, 0xF3, 0xFF, 0x5F, 0xF7, 0xFF, 0x77, 0xF7,
+		0xFF, 0x5F, 0xF7, 0xEB, 0xCF, 0xEB, 0xCF, 0xEB, 0xCF, 0xFE, 0xEF, 0xEF, 0xFE, 0xBF, 0xEF, 0xFE,
+		0xEF, 0xE9, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x7E, 0xFF, 0xEB, 0xFE, 0xFF, 0xEE, 0xFE, 0xFF, 0xEB,
+		0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xFF, 0xFB, 0x90, 0x00, 0x00, 0x00, 0x00, 0x74, 0x10, 0x5F, 0x00, 0x21, 0x0B,
+		0xF2, 0x0E, 0xA2, 0x0B, 0xE0, 0x04, 0x21, 0x7E, 0x41, 0xD4, 0x41, 0x7C, 0x00, 0x84, 0x2F, 0xC8,
+		0x3A, 0x88, 0x2F, 0x80, 0x10, 0x85, 0xF9, 0xF7, 0xE5, 0xF7, 0xE5, 0xF7, 0xE5, 0xFF, 0xBF, 0xFB,
+		0x7F, 0xBF, 0xF9, 0xFF, 0xBF, 0xF9, 0x7D, 0xF9, 0x7D, 0xF9, 0x7D, 0xFF, 0x6F, 0xF7, 0xFF, 0x3F,
+		0xF7, 0xFF, 0x6F, 0xF7, 0xE5, 0xF7, 0xE5, 0xF7, 0xE5, 0xF7, 0xFE, 0x7F, 0xEF, 0xFE, 0xDF, 0xEF,
+		0xFE, 0x7F, 0xED, 0xF9, 0x7D, 0xF9, 0x7D, 0xF9, 0x7E, 0xFF, 0xED, 0xFE, 0xFF, 0xE7, 0xFE, 0xFF,
+		0xED, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00
+	};
+
+	/** Interval between the samples kept in the stored decode of the MP3 fixture */
+	constexpr uint32 MP3FixtureDecodeStride = 16;
+
+	/** Maximum difference between a decoded sample of the MP3 fixture and its stored decode, to allow for differences in floating point rounding */
+	constexpr float MP3FixtureMaxError = 2.f / 32768.f;
+
+	/**
+	 * Stored decode of the MP3 fixture: every MP3FixtureDecodeStride-th sample of the interleaved 32-bit float PCM data, scaled by 32768 and rounded
+	 */
+	const int16 MP3FixtureDecode[] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 3, -3,
+		4, 2, -2, 4, 13, -12, 22, -17, 46, 16, -10, 42, 45, -96, 156, -104,
+		216, 165, -69, 166, 806, -95, 356, -361, -128, 530, 33, 833, -1425, -44, 847, -136,
+		-229, 2513, -62, 238, -1133, -443, 1065, -128, 587, -2647, 307, 938, -272, 27, 3688, -700,
+		-328, -1883, -594, 898, -392, 572, -4086, 691, 1341, -493, 153, 4123, -1610, -880, -2991, -673,
+		1101, -976, 191, -4874, 1207, 1501, -942, 258, 4246, -2939, -1539, -3421, -712, 1023, -1339, -229,
+		-5220, 1608, 1452, -1166, 158, 3715, -3540, -2121, -3783, -562, 902, -1760, -1161, -5083, 2870, 1190,
+		-1213, 92, 3235, -4795, -1211, -3268, 727, 519, -1557, -2895, -3904, 2324, 992, -1852, 819, 525,
+		-6294, 1370, -2253, 490, 474, -1585, 3194, -4695, -39, 1271, -1467, 422, 832, -3023, -4968, -1800,
+		-753, 1951, -455, 2799, -2969, 2498, -98, -280, -521, 3370, -917, -5489, -926, 656, -418, -1381,
+		-5617, 3142, 4011, -664, 53, 158, -217, -1335, 6031, -1326, 451, -2085, -910, -2117, 242, -1087,
+		960, -953, 564, -2710, 300, 3729, -56, -69, 1604, 1299, 5169, -5197, -2716, 763, -476, -389,
+		475, -1030, -5905, 2613, 781, 2568, 453, 888, 980, 2152, -1277, -86, -820, 1393, -3767, -1239,
+		211, 1288, -704, -1557, -2264, 3744, 5384, -1573, -1590, 559, -595, -4609, 4869, -1663, 2509, -1015,
+		-2862, 395, -1832, 6630, -813, -1791, 1665, -889, -6528, 2639, 670, 2766, -732, -2578, 1076, -955,
+		6506, -1414, -1205, 1466, -856, -5006, 1939, -104, 1095, -1270, -2018, 1306, -143, 4150, -587, -85,
+		697, -415, -2905, -386, -40, -374, -1038, -178, 369, 3548, -259, 721, 1109, 235, -188, 2015,
+		-429, -5061, -1650, -49, 1231, -294, -2892, -724, 4829, 605, 147, 557, 2023, -4070, 3692, -1449,
+		2196, -156, -1117, -1451, -3017, 1445, 1710, -1848, 1702, -411, -3164, -39, -414, 670, 2370, -512,
+		5265, -3920, 635, 465, 413, 216, 3321, -447, -6102, 264, -71, -494, -809, -5130, 5059, 2596,
+		-1180, 325, -104, -861, -631, 7445, -1478, 21, -1568, -515, 438, -4104, 154, 1396, -142, 636,
+		-457, -1008, -3488, 1798, 1247, 1336, 1073, 1147, -2036, 1626, -1515, 1470, 472, 775, 2659, -3362,
+		-1149, -472, -3073, 731, -1531, 3709, -3284, 162, 6, 944, -1709, 6897, 3201, -3422, -1660, 797,
+		876, 2368, -3083, -6574, 3041, -1391, -469, 660, 401, 118, 1288, -120, 3477, -1039, 750, 847,
+		-1075, -238, -2210, -1236, 1339, -5395, 3179, 2674, 1100, 596, -2807, -962, 3028, 5846, -3281, -162,
+		-602, -756, -5724, 1981, -61, 1211, -1396, 558, 154, -739, 4376, -2841, 225, 331, -204, 676,
+		-2356, 3666, -611, -2257, 214, -665, 2811, 45, 787, 2524, -705, -1772, 1940, -3301, -6134, 1039,
+		1351, 2956, -520, -4126, -2074, 4443, -730, 2102, 1949, 3208, -1532, 2855, -1781, 603, -2268, -45,
+		42, -1136, -1317, 10, -1886, 98, -1631, 1056, -1845, 1635, -443, 1605, -32, 2054, -110, 2067,
+		71, 1611, -944, 1212, -438, 29, -1410, 986, -1737, -298, -4074, 1081, -2405, 82, -1413, 2129,
+		-961, 3524, 1132, -675, -1085, 1837, 277, 6081, -2, -2504, -640, -920, -1984, 570, -5113, -552,
+		4164, 541, -651, -1662, -3586, 1949, 3527, 525, 2274, 296, -743, -2624, 2358, -2773, -328, 252,
+		1769, -423, -3626, 4519, -313, -1115, -129, 1081, 5274, -4928, -1658, 1301, -721, -526, -214, 1424,
+		-5798, 1007, -539, 2512, 725, 2146, -173, 995, -949, 941, -1070, 2851, -337, -3725, -110, 254,
+		-1477, -205, -4914, 6226, 2813, -406, -476, 205, -1439, 2241, 5413, -2069, -598, -1798, -2287, -443,
+		-1789, -2800, 486, 417, 995, -261, -2973, 2825, -159, 567, 1248, 2709, 2321, -3616, 3267, 588
+	};
+}
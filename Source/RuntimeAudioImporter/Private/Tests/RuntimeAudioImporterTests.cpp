@@ -0,0 +1,569 @@
+// Georgy Treshchev 2022.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "RuntimeAudioImporterLibrary.h"
+#include "RuntimeAudioCompressor.h"
+#include "ImportedSoundWave.h"
+#include "RuntimeAudioImporterTypes.h"
+#include "Tests/RuntimeAudioImporterFixtures.h"
+#include "Tests/RuntimeAudioImporterMP3Fixture.h"
+
+#include "HAL/PlatformMisc.h"
+
+namespace
+{
+	/** Sample rate of the synthesized audio data */
+	constexpr uint32 TestSampleRate = 44100;
+
+	/** Stored baseline of an operation. Runs slower than the minimum throughput or allocating more than the maximum ratio fail */
+	struct FPerformanceBaseline
+	{
+		/** Name of the operation, e.g. "Import.Wav" */
+		const TCHAR* Name;
+
+		/** Minimum seconds of audio processed per second of wall time, summed over all concurrent operations */
+		float MinThroughput;
+
+		/** Maximum peak allocation size of a single import relative to the size of its PCM data. Zero if not measured */
+		float MaxPeakAllocationRatio;
+	};
+
+	/**
+	 * Stored baselines. Set as conservative floors for a headless run (-nullrhi -nosound) on a development machine
+	 * The measured values of every case are logged, so the baselines can be tightened from the results of the reference machine
+	 */
+	const FPerformanceBaseline PerformanceBaselines[] = {
+		{TEXT("Import.Wav"), 20.f, 3.f},
+		{TEXT("Import.Flac"), 10.f, 3.f},
+		{TEXT("Import.Mp3"), 10.f, 3.f},
+		{TEXT("Import.OggVorbis"), 5.f, 3.f},
+		{TEXT("Export.Wav"), 50.f, 0.f},
+		{TEXT("Export.OggVorbis"), 2.f, 0.f},
+		{TEXT("Compress"), 10.f, 0.f}
+	};
+
+	/** Formats of the synthesized audio data */
+	const EAudioFormat TestFormats[] = {EAudioFormat::Wav, EAudioFormat::Flac, EAudioFormat::Mp3, EAudioFormat::OggVorbis};
+
+	/** Durations of the synthesized audio data, in seconds */
+	const float TestDurations[] = {5.f, 30.f};
+
+	/** Numbers of channels of the synthesized audio data */
+	const uint32 TestNumsOfChannels[] = {1, 2};
+
+	/** Numbers of concurrent imports. Levels above the number of worker threads are skipped */
+	const int32 TestConcurrencyLevels[] = {1, 2, 4, 8};
+
+	/**
+	 * Find the stored baseline of the operation
+	 */
+	const FPerformanceBaseline* FindPerformanceBaseline(const FString& Name)
+	{
+		for (const FPerformanceBaseline& Baseline : PerformanceBaselines)
+		{
+			if (Name == Baseline.Name)
+			{
+				return &Baseline;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Generate interleaved 32-bit float PCM data of the test signal
+	 */
+	TArray<float> GenerateSignal(uint32 NumOfChannels, uint32 NumOfFrames)
+	{
+		TArray<float> Signal;
+		Signal.SetNumUninitialized(NumOfFrames * NumOfChannels);
+
+		for (uint32 FrameIndex = 0; FrameIndex < NumOfFrames; ++FrameIndex)
+		{
+			for (uint32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+			{
+				Signal[FrameIndex * NumOfChannels + ChannelIndex] = RuntimeAudioImporter_Fixtures::GetSignalSample(ChannelIndex, FrameIndex, TestSampleRate);
+			}
+		}
+
+		return Signal;
+	}
+
+	/**
+	 * Wrap interleaved 32-bit float PCM data into the decoded audio info
+	 */
+	FDecodedAudioStruct MakeDecodedAudioInfo(const TArray<float>& Signal, uint32 NumOfChannels)
+	{
+		const int64 PCMDataSize = Signal.Num() * sizeof(float);
+
+		FDecodedAudioStruct DecodedAudioInfo;
+		DecodedAudioInfo.PCMInfo.PCMData = FSharedPCMBuffer(static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(PCMDataSize), Signal.GetData(), PCMDataSize)), PCMDataSize);
+		DecodedAudioInfo.PCMInfo.PCMNumOfFrames = Signal.Num() / NumOfChannels;
+		DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels = NumOfChannels;
+		DecodedAudioInfo.SoundWaveBasicInfo.SampleRate = TestSampleRate;
+		DecodedAudioInfo.SoundWaveBasicInfo.Duration = static_cast<float>(DecodedAudioInfo.PCMInfo.PCMNumOfFrames) / TestSampleRate;
+
+		return DecodedAudioInfo;
+	}
+
+	/**
+	 * Synthesize audio data of the specified format. The signal the audio data was made from is returned for comparison
+	 * The MP3 audio data is written from spectral values rather than made from a signal, so a silent signal of the expected length is returned for it
+	 */
+	bool SynthesizeAudioData(EAudioFormat AudioFormat, uint32 NumOfChannels, float Duration, TArray<uint8>& AudioData, TArray<float>& Signal)
+	{
+		const uint32 NumOfFrames = static_cast<uint32>(Duration * TestSampleRate);
+
+		switch (AudioFormat)
+		{
+		case EAudioFormat::Flac:
+			{
+				Signal = GenerateSignal(NumOfChannels, NumOfFrames);
+				AudioData.SetNumUninitialized(static_cast<int32>(RuntimeAudioImporter_Fixtures::GetFlacSize(NumOfChannels, NumOfFrames)));
+				RuntimeAudioImporter_Fixtures::SynthesizeFlac(Signal.GetData(), NumOfChannels, NumOfFrames, TestSampleRate, AudioData.GetData());
+				return true;
+			}
+		case EAudioFormat::Mp3:
+			{
+				AudioData.SetNumUninitialized(static_cast<int32>(RuntimeAudioImporter_Fixtures::GetMP3Size(NumOfFrames)));
+				RuntimeAudioImporter_Fixtures::SynthesizeMP3(NumOfChannels, NumOfFrames, AudioData.GetData());
+				Signal.SetNumZeroed(FMath::DivideAndRoundUp(NumOfFrames, RuntimeAudioImporter_Fixtures::MP3FrameNumOfFrames) * RuntimeAudioImporter_Fixtures::MP3FrameNumOfFrames * NumOfChannels);
+				return true;
+			}
+		case EAudioFormat::Wav:
+		case EAudioFormat::OggVorbis:
+			{
+				Signal = GenerateSignal(NumOfChannels, NumOfFrames);
+
+				FEncodedAudioStruct EncodedAudioInfo;
+				EncodedAudioInfo.AudioFormat = AudioFormat;
+
+				if (!URuntimeAudioImporterLibrary::EncodeAudioData(MakeDecodedAudioInfo(Signal, NumOfChannels), EncodedAudioInfo, 50))
+				{
+					return false;
+				}
+
+				AudioData = TArray<uint8>(EncodedAudioInfo.AudioData.GetView().GetData(), EncodedAudioInfo.AudioData.GetView().Num());
+				return true;
+			}
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * Get the name of the audio format without the enum prefix, e.g. "Wav"
+	 */
+	FString GetAudioFormatName(EAudioFormat AudioFormat)
+	{
+		return StaticEnum<EAudioFormat>()->GetNameStringByValue(static_cast<int64>(AudioFormat));
+	}
+
+	/**
+	 * Get the name of the test case
+	 */
+	FString GetCaseName(EAudioFormat AudioFormat, uint32 NumOfChannels, float Duration)
+	{
+		return FString::Printf(TEXT("%s, %u channel(s), %.0f seconds"), *GetAudioFormatName(AudioFormat), NumOfChannels, Duration);
+	}
+
+	/**
+	 * Compare the measured values of an operation against its stored baseline
+	 */
+	void CheckPerformanceBaseline(FAutomationTestBase& Test, const FString& BaselineName, const FString& CaseName, float Throughput, float PeakAllocationRatio = 0.f)
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s (%s): throughput '%.2fx', peak allocation ratio '%.2f'"), *BaselineName, *CaseName, Throughput, PeakAllocationRatio));
+
+		const FPerformanceBaseline* Baseline = FindPerformanceBaseline(BaselineName);
+		if (Baseline == nullptr)
+		{
+			Test.AddWarning(FString::Printf(TEXT("There is no stored baseline for '%s'"), *BaselineName));
+			return;
+		}
+
+		if (Throughput < Baseline->MinThroughput)
+		{
+			Test.AddError(FString::Printf(TEXT("%s (%s): the throughput '%.2fx' is below the baseline of '%.2fx'"), *BaselineName, *CaseName, Throughput, Baseline->MinThroughput));
+		}
+
+		if (Baseline->MaxPeakAllocationRatio > 0.f && PeakAllocationRatio > Baseline->MaxPeakAllocationRatio)
+		{
+			Test.AddError(FString::Printf(TEXT("%s (%s): the peak allocation ratio '%.2f' is above the baseline of '%.2f'"), *BaselineName, *CaseName, PeakAllocationRatio, Baseline->MaxPeakAllocationRatio));
+		}
+	}
+
+	/**
+	 * Latent command running the performance cases one after another. The imports and the compression complete on the game thread, so the command waits for them between updates
+	 */
+	class FImportPerformanceCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FImportPerformanceCommand(FAutomationTestBase& InTest)
+			: Test(InTest)
+		  , State(MakeShared<FState>())
+		{
+			const int32 NumOfWorkerThreads = FPlatformMisc::NumberOfWorkerThreadsToSpawn();
+
+			for (const EAudioFormat AudioFormat : TestFormats)
+			{
+				for (const uint32 NumOfChannels : TestNumsOfChannels)
+				{
+					for (const float Duration : TestDurations)
+					{
+						for (const int32 Concurrency : TestConcurrencyLevels)
+						{
+							if (Concurrency == 1 || Concurrency <= NumOfWorkerThreads)
+							{
+								Cases.Add(FCase{AudioFormat, NumOfChannels, Duration, Concurrency});
+							}
+						}
+					}
+				}
+			}
+		}
+
+		virtual bool Update() override
+		{
+			if (State->NumOfPendingOperations > 0)
+			{
+				return false;
+			}
+
+			if (State->bRunning)
+			{
+				FinishCase();
+
+				// Waiting for the compression of the imported sound wave
+				if (State->NumOfPendingOperations > 0)
+				{
+					return false;
+				}
+			}
+
+			ReleaseObjects();
+
+			if (CaseIndex >= Cases.Num())
+			{
+				return true;
+			}
+
+			StartCase(Cases[CaseIndex++]);
+			return false;
+		}
+
+	private:
+		/** Performance case */
+		struct FCase
+		{
+			EAudioFormat AudioFormat;
+			uint32 NumOfChannels;
+			float Duration;
+			int32 Concurrency;
+		};
+
+		/** State shared with the result delegates */
+		struct FState
+		{
+			int32 NumOfPendingOperations = 0;
+			bool bRunning = false;
+			double StartTime = 0.;
+			double EndTime = 0.;
+			float PeakAllocationRatio = 0.f;
+			bool bFailed = false;
+			TArray<UImportedSoundWave*> SoundWaves;
+			TArray<UObject*> RootedObjects;
+		};
+
+		void StartCase(const FCase& Case)
+		{
+			State->bRunning = true;
+			State->bFailed = false;
+			State->PeakAllocationRatio = 0.f;
+			State->SoundWaves.Reset();
+			State->NumOfPendingOperations = Case.Concurrency;
+
+			// The inputs are synthesized once and shared by the concurrency levels
+			const FString InputName = GetCaseName(Case.AudioFormat, Case.NumOfChannels, Case.Duration);
+			TArray<uint8>* AudioData = Inputs.Find(InputName);
+
+			if (AudioData == nullptr)
+			{
+				TArray<uint8> SynthesizedAudioData;
+				TArray<float> Signal;
+
+				if (SynthesizeAudioData(Case.AudioFormat, Case.NumOfChannels, Case.Duration, SynthesizedAudioData, Signal))
+				{
+					AudioData = &Inputs.Add(InputName, MoveTemp(SynthesizedAudioData));
+				}
+			}
+
+			if (AudioData == nullptr)
+			{
+				Test.AddError(FString::Printf(TEXT("Unable to synthesize the audio data for '%s'"), *GetCaseName(Case.AudioFormat, Case.NumOfChannels, Case.Duration)));
+				State->bRunning = false;
+				State->NumOfPendingOperations = 0;
+				return;
+			}
+
+			TArray<URuntimeAudioImporterLibrary*> Importers;
+
+			for (int32 ImportIndex = 0; ImportIndex < Case.Concurrency; ++ImportIndex)
+			{
+				URuntimeAudioImporterLibrary* Importer = URuntimeAudioImporterLibrary::CreateRuntimeAudioImporter();
+				Importer->AddToRoot();
+				State->RootedObjects.Add(Importer);
+
+				Importer->OnResultWithTimingReportNative.AddLambda([State = State](URuntimeAudioImporterLibrary*, UImportedSoundWave* SoundWave, ETranscodingStatus Status, const FImportTimingReport& TimingReport)
+				{
+					if (Status != ETranscodingStatus::SuccessfulImport || SoundWave == nullptr)
+					{
+						State->bFailed = true;
+					}
+					else
+					{
+						SoundWave->AddToRoot();
+						State->RootedObjects.Add(SoundWave);
+						State->SoundWaves.Add(SoundWave);
+
+						if (TimingReport.OutputSize > 0)
+						{
+							State->PeakAllocationRatio = FMath::Max(State->PeakAllocationRatio, static_cast<float>(TimingReport.PeakAllocationSize) / TimingReport.OutputSize);
+						}
+					}
+
+					State->EndTime = FPlatformTime::Seconds();
+					--State->NumOfPendingOperations;
+				});
+
+				Importers.Add(Importer);
+			}
+
+			State->StartTime = FPlatformTime::Seconds();
+
+			for (URuntimeAudioImporterLibrary* Importer : Importers)
+			{
+				Importer->ImportAudioFromBuffer(*AudioData, Case.AudioFormat);
+			}
+
+			RunningCase = Case;
+		}
+
+		void FinishCase()
+		{
+			State->bRunning = false;
+
+			const FString CaseName = FString::Printf(TEXT("%s, %d concurrent import(s)"), *GetCaseName(RunningCase.AudioFormat, RunningCase.NumOfChannels, RunningCase.Duration), RunningCase.Concurrency);
+
+			if (State->bFailed || State->SoundWaves.Num() != RunningCase.Concurrency)
+			{
+				Test.AddError(FString::Printf(TEXT("Unable to import '%s'"), *CaseName));
+			}
+			else
+			{
+				const float Throughput = static_cast<float>(RunningCase.Duration * RunningCase.Concurrency / FMath::Max(State->EndTime - State->StartTime, SMALL_NUMBER));
+				CheckPerformanceBaseline(Test, FString::Printf(TEXT("Import.%s"), *GetAudioFormatName(RunningCase.AudioFormat)), CaseName, Throughput, State->PeakAllocationRatio);
+
+				// Exporting and compressing the imported sound wave once per input
+				if (RunningCase.Concurrency == 1)
+				{
+					MeasureExport(State->SoundWaves[0], CaseName);
+					MeasureCompress(State->SoundWaves[0], CaseName);
+				}
+			}
+		}
+
+		void MeasureExport(UImportedSoundWave* SoundWave, const FString& CaseName)
+		{
+			for (const EAudioFormat AudioFormat : {EAudioFormat::Wav, EAudioFormat::OggVorbis})
+			{
+				const FString BaselineName = FString::Printf(TEXT("Export.%s"), *GetAudioFormatName(AudioFormat));
+
+				TArray<uint8> ExportedAudioData;
+				const double StartTime = FPlatformTime::Seconds();
+
+				if (!URuntimeAudioImporterLibrary::ExportSoundWaveToBuffer(SoundWave, ExportedAudioData, AudioFormat, 50))
+				{
+					Test.AddError(FString::Printf(TEXT("%s (%s): unable to export"), *BaselineName, *CaseName));
+					continue;
+				}
+
+				CheckPerformanceBaseline(Test, BaselineName, CaseName, static_cast<float>(SoundWave->GetDurationConst() / FMath::Max(FPlatformTime::Seconds() - StartTime, SMALL_NUMBER)));
+			}
+		}
+
+		void MeasureCompress(UImportedSoundWave* SoundWave, const FString& CaseName)
+		{
+			URuntimeAudioCompressor* Compressor = URuntimeAudioCompressor::CreateRuntimeAudioCompressor();
+			Compressor->AddToRoot();
+			State->RootedObjects.Add(Compressor);
+
+			Compressor->OnResultNative.AddLambda([this, State = State, Duration = SoundWave->GetDurationConst(), CaseName, StartTime = FPlatformTime::Seconds()](bool bSuccess, USoundWave*)
+			{
+				if (!bSuccess)
+				{
+					Test.AddError(FString::Printf(TEXT("Compress (%s): unable to compress"), *CaseName));
+				}
+				else
+				{
+					CheckPerformanceBaseline(Test, TEXT("Compress"), CaseName, static_cast<float>(Duration / FMath::Max(FPlatformTime::Seconds() - StartTime, SMALL_NUMBER)));
+				}
+
+				--State->NumOfPendingOperations;
+			});
+
+			++State->NumOfPendingOperations;
+			Compressor->CompressSoundWave(SoundWave, FCompressedSoundWaveInfo(), 50, false, true);
+		}
+
+		void ReleaseObjects()
+		{
+			for (UImportedSoundWave* SoundWave : State->SoundWaves)
+			{
+				SoundWave->ReleaseMemory();
+			}
+
+			for (UObject* RootedObject : State->RootedObjects)
+			{
+				RootedObject->RemoveFromRoot();
+			}
+
+			State->SoundWaves.Reset();
+			State->RootedObjects.Reset();
+		}
+
+		FAutomationTestBase& Test;
+		TSharedRef<FState> State;
+		TArray<FCase> Cases;
+		TMap<FString, TArray<uint8>> Inputs;
+		int32 CaseIndex = 0;
+		FCase RunningCase{EAudioFormat::Invalid, 0, 0.f, 0};
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterDecodeTest, "RuntimeAudioImporter.Decode", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRuntimeAudioImporterDecodeTest::RunTest(const FString& Parameters)
+{
+	for (const EAudioFormat AudioFormat : TestFormats)
+	{
+		for (const uint32 NumOfChannels : TestNumsOfChannels)
+		{
+			const float Duration = TestDurations[0];
+			const FString CaseName = GetCaseName(AudioFormat, NumOfChannels, Duration);
+
+			TArray<uint8> AudioData;
+			TArray<float> Signal;
+
+			if (!SynthesizeAudioData(AudioFormat, NumOfChannels, Duration, AudioData, Signal))
+			{
+				AddError(FString::Printf(TEXT("Unable to synthesize the audio data for '%s'"), *CaseName));
+				continue;
+			}
+
+			TestTrue(FString::Printf(TEXT("Detected format of '%s'"), *CaseName), URuntimeAudioImporterLibrary::GetAudioFormat(AudioData.GetData(), AudioData.Num()) == AudioFormat);
+
+			uint8* EncodedAudioDataPtr = static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(AudioData.Num()), AudioData.GetData(), AudioData.Num()));
+			FEncodedAudioStruct EncodedAudioInfo(EncodedAudioDataPtr, AudioData.Num(), EAudioFormat::Auto);
+			FDecodedAudioStruct DecodedAudioInfo;
+
+			if (!URuntimeAudioImporterLibrary::DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo))
+			{
+				AddError(FString::Printf(TEXT("Unable to decode '%s'"), *CaseName));
+				continue;
+			}
+
+			TestTrue(FString::Printf(TEXT("Number of channels of '%s'"), *CaseName), DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels == NumOfChannels);
+			TestTrue(FString::Printf(TEXT("Sample rate of '%s'"), *CaseName), DecodedAudioInfo.SoundWaveBasicInfo.SampleRate == TestSampleRate);
+
+			const TArrayView<const float> DecodedSignal(reinterpret_cast<const float*>(DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData()), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num() / sizeof(float));
+
+			// The lossless formats reproduce the signal exactly, the lossy formats may differ in length by up to a frame of the codec
+			// The samples of the MP3 audio data are compared against the stored decode of the MP3 fixture below
+			const bool bLossy{AudioFormat == EAudioFormat::Mp3 || AudioFormat == EAudioFormat::OggVorbis};
+			const int32 MaxLengthDifference = bLossy ? static_cast<int32>(RuntimeAudioImporter_Fixtures::MP3FrameNumOfFrames * NumOfChannels) : 0;
+
+			if (!TestTrue(FString::Printf(TEXT("Number of samples of '%s' (decoded '%d', expected '%d')"), *CaseName, DecodedSignal.Num(), Signal.Num()), FMath::Abs(DecodedSignal.Num() - Signal.Num()) <= MaxLengthDifference))
+			{
+				continue;
+			}
+
+			const int32 NumOfComparedSamples = FMath::Min(DecodedSignal.Num(), Signal.Num());
+
+			if (AudioFormat == EAudioFormat::Mp3)
+			{
+				float MaxAmplitude = 0.f;
+				for (int32 SampleIndex = 0; SampleIndex < NumOfComparedSamples; ++SampleIndex)
+				{
+					MaxAmplitude = FMath::Max(MaxAmplitude, FMath::Abs(DecodedSignal[SampleIndex]));
+				}
+
+				TestTrue(FString::Printf(TEXT("Samples of '%s' (maximum amplitude '%f')"), *CaseName, MaxAmplitude), MaxAmplitude > KINDA_SMALL_NUMBER);
+			}
+			else if (AudioFormat == EAudioFormat::OggVorbis)
+			{
+				double SignalEnergy = 0., DecodedEnergy = 0.;
+				for (int32 SampleIndex = 0; SampleIndex < NumOfComparedSamples; ++SampleIndex)
+				{
+					SignalEnergy += FMath::Square(Signal[SampleIndex]);
+					DecodedEnergy += FMath::Square(DecodedSignal[SampleIndex]);
+				}
+
+				TestTrue(FString::Printf(TEXT("Energy of '%s'"), *CaseName), FMath::IsNearlyEqual(DecodedEnergy / SignalEnergy, 1., 0.1));
+			}
+			else
+			{
+				float MaxError = 0.f;
+				for (int32 SampleIndex = 0; SampleIndex < NumOfComparedSamples; ++SampleIndex)
+				{
+					MaxError = FMath::Max(MaxError, FMath::Abs(DecodedSignal[SampleIndex] - Signal[SampleIndex]));
+				}
+
+				TestTrue(FString::Printf(TEXT("Samples of '%s' (maximum error '%f')"), *CaseName, MaxError), MaxError == 0.f);
+			}
+		}
+	}
+
+	// The MP3 fixture is compared against its stored decode, which covers the Huffman decoding, the requantization and the synthesis filterbank of the MP3 decoder
+	{
+		uint8* EncodedAudioDataPtr = static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(sizeof(RuntimeAudioImporter_Fixtures::MP3Fixture)), RuntimeAudioImporter_Fixtures::MP3Fixture, sizeof(RuntimeAudioImporter_Fixtures::MP3Fixture)));
+		FEncodedAudioStruct EncodedAudioInfo(EncodedAudioDataPtr, sizeof(RuntimeAudioImporter_Fixtures::MP3Fixture), EAudioFormat::Mp3);
+		FDecodedAudioStruct DecodedAudioInfo;
+
+		if (!URuntimeAudioImporterLibrary::DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo))
+		{
+			AddError(TEXT("Unable to decode the MP3 fixture"));
+			return true;
+		}
+
+		TestTrue(TEXT("Number of channels of the MP3 fixture"), DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels == RuntimeAudioImporter_Fixtures::MP3FixtureNumOfChannels);
+		TestTrue(TEXT("Sample rate of the MP3 fixture"), DecodedAudioInfo.SoundWaveBasicInfo.SampleRate == RuntimeAudioImporter_Fixtures::MP3FixtureSampleRate);
+
+		const TArrayView<const float> DecodedSignal(reinterpret_cast<const float*>(DecodedAudioInfo.PCMInfo.PCMData.GetView().GetData()), DecodedAudioInfo.PCMInfo.PCMData.GetView().Num() / sizeof(float));
+
+		if (TestTrue(FString::Printf(TEXT("Number of samples of the MP3 fixture (decoded '%d')"), DecodedSignal.Num()), DecodedSignal.Num() == static_cast<int32>(RuntimeAudioImporter_Fixtures::MP3FixtureNumOfFrames * RuntimeAudioImporter_Fixtures::MP3FixtureNumOfChannels)))
+		{
+			float MaxError = 0.f;
+			for (uint32 DecodeIndex = 0; DecodeIndex < UE_ARRAY_COUNT(RuntimeAudioImporter_Fixtures::MP3FixtureDecode); ++DecodeIndex)
+			{
+				MaxError = FMath::Max(MaxError, FMath::Abs(DecodedSignal[DecodeIndex * RuntimeAudioImporter_Fixtures::MP3FixtureDecodeStride] - RuntimeAudioImporter_Fixtures::MP3FixtureDecode[DecodeIndex] / 32768.f));
+			}
+
+			TestTrue(FString::Printf(TEXT("Samples of the MP3 fixture (maximum error '%f')"), MaxError), MaxError <= RuntimeAudioImporter_Fixtures::MP3FixtureMaxError);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuntimeAudioImporterPerformanceTest, "RuntimeAudioImporter.Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FRuntimeAudioImporterPerformanceTest::RunTest(const FString& Parameters)
+{
+	ADD_LATENT_AUTOMATION_COMMAND(FImportPerformanceCommand(*this));
+	return true;
+}
+
+#endif
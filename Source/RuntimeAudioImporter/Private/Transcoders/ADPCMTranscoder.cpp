@@ -0,0 +1,262 @@
+// Georgy Treshchev 2022.
+
+#include "Transcoders/ADPCMTranscoder.h"
+#include "Transcoders/RAWTranscoder.h"
+#include "Processors/AudioVectorMath.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "RuntimeAudioImporterTypes.h"
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Size of the block of a single channel, in bytes. The engine's ADPCM decoder reads the blocks of each channel separately */
+	constexpr int32 BlockSize = 512;
+
+	/** Size of the block header: predictor index, initial delta and two initial samples */
+	constexpr int32 BlockHeaderSize = 7;
+
+	/** Number of frames in a single block. Two of them are stored in the header, the rest are stored as 4-bit nibbles */
+	constexpr int32 FramesPerBlock = (BlockSize - BlockHeaderSize) * 2 + 2;
+
+	/** Number of blocks encoded by a single parallel task */
+	constexpr int32 BlocksPerTask = 64;
+
+	/** Size of the WAV header: RIFF header, "fmt " chunk with the coefficient table, "fact" chunk and "data" chunk header */
+	constexpr int32 HeaderSize = 12 + (8 + 50) + (8 + 4) + 8;
+
+	/** Minimum quantization step */
+	constexpr int32 MinDelta = 16;
+
+	/** Number of frames used to estimate the initial quantization step of the block */
+	constexpr int32 NumOfDeltaEstimationFrames = 16;
+
+	/** WAVE_FORMAT_ADPCM */
+	constexpr uint16 WaveFormatADPCM = 2;
+
+	constexpr int32 NumOfPredictors = 7;
+	const int32 AdaptationCoefficient1[NumOfPredictors] = {256, 512, 0, 192, 240, 460, 392};
+	const int32 AdaptationCoefficient2[NumOfPredictors] = {0, -256, 0, 64, 0, -208, -232};
+	const int32 AdaptationTable[16] = {230, 230, 230, 230, 307, 409, 512, 614, 768, 614, 512, 409, 307, 230, 230, 230};
+
+	/**
+	 * Write an integer value in little-endian byte order and advance the pointer
+	 */
+	template <typename IntegerType>
+	void WriteLittleEndian(uint8*& Data, IntegerType Value)
+	{
+		const uint32 UnsignedValue = static_cast<uint32>(Value);
+		for (int32 ByteIndex = 0; ByteIndex < static_cast<int32>(sizeof(IntegerType)); ++ByteIndex)
+		{
+			*Data++ = static_cast<uint8>((UnsignedValue >> (ByteIndex * 8)) & 0xFF);
+		}
+	}
+
+	/**
+	 * Write a four-character chunk identifier and advance the pointer
+	 */
+	void WriteChunkID(uint8*& Data, const ANSICHAR* ChunkID)
+	{
+		FMemory::Memcpy(Data, ChunkID, 4);
+		Data += 4;
+	}
+
+	/**
+	 * Choose the predictor that minimizes the prediction error energy of the block, estimated from its autocorrelation
+	 */
+	int32 ChoosePredictor(const float* Samples)
+	{
+		const int32 NumOfPredictedSamples = FramesPerBlock - 2;
+
+		const float Autocorrelation0 = RuntimeAudioImporter_VectorMath::DotProduct(Samples + 2, Samples + 2, NumOfPredictedSamples);
+		const float Autocorrelation1 = RuntimeAudioImporter_VectorMath::DotProduct(Samples + 2, Samples + 1, NumOfPredictedSamples);
+		const float Autocorrelation2 = RuntimeAudioImporter_VectorMath::DotProduct(Samples + 2, Samples, NumOfPredictedSamples);
+
+		int32 BestPredictor = 0;
+		float BestErrorEnergy = TNumericLimits<float>::Max();
+
+		for (int32 Predictor = 0; Predictor < NumOfPredictors; ++Predictor)
+		{
+			const float Coefficient1 = AdaptationCoefficient1[Predictor] / 256.f;
+			const float Coefficient2 = AdaptationCoefficient2[Predictor] / 256.f;
+
+			const float ErrorEnergy = Autocorrelation0 * (1.f + Coefficient1 * Coefficient1 + Coefficient2 * Coefficient2)
+				- 2.f * Coefficient1 * Autocorrelation1 - 2.f * Coefficient2 * Autocorrelation2 + 2.f * Coefficient1 * Coefficient2 * Autocorrelation1;
+
+			if (ErrorEnergy < BestErrorEnergy)
+			{
+				BestErrorEnergy = ErrorEnergy;
+				BestPredictor = Predictor;
+			}
+		}
+
+		return BestPredictor;
+	}
+
+	/**
+	 * Encode a block of a single channel
+	 *
+	 * @param Samples Samples of the channel in the 16-bit range, already rounded. Must contain exactly FramesPerBlock samples
+	 * @param OutBlock Pointer to the memory of BlockSize bytes to write the block to
+	 */
+	void EncodeBlock(const float* Samples, uint8* OutBlock)
+	{
+		const int32 Predictor = ChoosePredictor(Samples);
+		const int32 Coefficient1 = AdaptationCoefficient1[Predictor];
+		const int32 Coefficient2 = AdaptationCoefficient2[Predictor];
+
+		int32 Sample1 = static_cast<int32>(Samples[1]);
+		int32 Sample2 = static_cast<int32>(Samples[0]);
+
+		// Estimating the initial quantization step from the prediction error of the first frames
+		int32 Delta;
+		{
+			int32 SumOfErrors = 0;
+			for (int32 SampleIndex = 2; SampleIndex < 2 + NumOfDeltaEstimationFrames; ++SampleIndex)
+			{
+				const int32 PredictedSample = (static_cast<int32>(Samples[SampleIndex - 1]) * Coefficient1 + static_cast<int32>(Samples[SampleIndex - 2]) * Coefficient2) >> 8;
+				SumOfErrors += FMath::Abs(static_cast<int32>(Samples[SampleIndex]) - PredictedSample);
+			}
+
+			Delta = FMath::Clamp(SumOfErrors / NumOfDeltaEstimationFrames / 4, MinDelta, static_cast<int32>(MAX_int16));
+		}
+
+		// Writing the block header
+		{
+			uint8* HeaderData = OutBlock;
+			*HeaderData++ = static_cast<uint8>(Predictor);
+			WriteLittleEndian<int16>(HeaderData, static_cast<int16>(Delta));
+			WriteLittleEndian<int16>(HeaderData, static_cast<int16>(Sample1));
+			WriteLittleEndian<int16>(HeaderData, static_cast<int16>(Sample2));
+		}
+
+		// Quantizing the prediction error of the remaining frames, reconstructing each sample the same way the decoder does to keep the predictor in sync
+		uint8* NibbleData = OutBlock + BlockHeaderSize;
+		for (int32 SampleIndex = 2; SampleIndex < FramesPerBlock; ++SampleIndex)
+		{
+			const int32 PredictedSample = (Sample1 * Coefficient1 + Sample2 * Coefficient2) >> 8;
+			const int32 Error = static_cast<int32>(Samples[SampleIndex]) - PredictedSample;
+
+			const int32 Nibble = FMath::Clamp((Error + (Error >= 0 ? Delta / 2 : -Delta / 2)) / Delta, -8, 7);
+			const int32 ReconstructedSample = FMath::Clamp(PredictedSample + Nibble * Delta, static_cast<int32>(MIN_int16), static_cast<int32>(MAX_int16));
+
+			Sample2 = Sample1;
+			Sample1 = ReconstructedSample;
+			Delta = FMath::Max((AdaptationTable[Nibble & 0xF] * Delta) >> 8, MinDelta);
+
+			// The high nibble comes first
+			if ((SampleIndex & 1) == 0)
+			{
+				*NibbleData = static_cast<uint8>((Nibble & 0xF) << 4);
+			}
+			else
+			{
+				*NibbleData++ |= static_cast<uint8>(Nibble & 0xF);
+			}
+		}
+	}
+}
+
+bool ADPCMTranscoder::Encode(const FDecodedAudioStruct& DecodedData, FEncodedAudioStruct& EncodedData)
+{
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("ADPCMTranscoder::Encode", DecodedData.PCMInfo.PCMData.GetView().Num());
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Encoding uncompressed audio data to ADPCM audio format.\nDecoded audio info: %s"), *DecodedData.ToString()));
+
+	const int32 NumOfChannels = static_cast<int32>(DecodedData.SoundWaveBasicInfo.NumOfChannels);
+	const int64 NumOfFrames = static_cast<int64>(DecodedData.PCMInfo.PCMNumOfFrames);
+
+	if (NumOfChannels <= 0 || NumOfFrames <= 0)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(TEXT("Unable to encode empty audio data to ADPCM"));
+		return false;
+	}
+
+	const int64 NumOfBlocks = FMath::DivideAndRoundUp<int64>(NumOfFrames, FramesPerBlock);
+	const int64 BlocksDataSize = NumOfBlocks * NumOfChannels * BlockSize;
+	const int64 EncodedDataSize = HeaderSize + BlocksDataSize;
+
+	if (EncodedDataSize > MAX_int32)
+	{
+		RuntimeAudioImporter_TranscoderLogs::PrintError(FString::Printf(TEXT("Unable to encode audio data to ADPCM: the encoded size '%lld' exceeds the limit of the WAV container"), EncodedDataSize));
+		return false;
+	}
+
+	uint8* EncodedAudioData = static_cast<uint8*>(FMemory::Malloc(EncodedDataSize));
+
+	// Writing the WAV header
+	{
+		uint8* HeaderData = EncodedAudioData;
+
+		WriteChunkID(HeaderData, "RIFF");
+		WriteLittleEndian<uint32>(HeaderData, static_cast<uint32>(EncodedDataSize - 8));
+		WriteChunkID(HeaderData, "WAVE");
+
+		WriteChunkID(HeaderData, "fmt ");
+		WriteLittleEndian<uint32>(HeaderData, 50);
+		WriteLittleEndian<uint16>(HeaderData, WaveFormatADPCM);
+		WriteLittleEndian<uint16>(HeaderData, static_cast<uint16>(NumOfChannels));
+		WriteLittleEndian<uint32>(HeaderData, DecodedData.SoundWaveBasicInfo.SampleRate);
+		WriteLittleEndian<uint32>(HeaderData, static_cast<uint32>(static_cast<int64>(DecodedData.SoundWaveBasicInfo.SampleRate) * BlockSize * NumOfChannels / FramesPerBlock));
+		WriteLittleEndian<uint16>(HeaderData, BlockSize);
+		WriteLittleEndian<uint16>(HeaderData, 4);
+		WriteLittleEndian<uint16>(HeaderData, 4 + NumOfPredictors * 4);
+		WriteLittleEndian<uint16>(HeaderData, FramesPerBlock);
+		WriteLittleEndian<uint16>(HeaderData, NumOfPredictors);
+		for (int32 Predictor = 0; Predictor < NumOfPredictors; ++Predictor)
+		{
+			WriteLittleEndian<int16>(HeaderData, static_cast<int16>(AdaptationCoefficient1[Predictor]));
+			WriteLittleEndian<int16>(HeaderData, static_cast<int16>(AdaptationCoefficient2[Predictor]));
+		}
+
+		WriteChunkID(HeaderData, "fact");
+		WriteLittleEndian<uint32>(HeaderData, 4);
+		WriteLittleEndian<uint32>(HeaderData, static_cast<uint32>(NumOfFrames));
+
+		WriteChunkID(HeaderData, "data");
+		WriteLittleEndian<uint32>(HeaderData, static_cast<uint32>(BlocksDataSize));
+
+		check(HeaderData - EncodedAudioData == HeaderSize);
+	}
+
+	const float* PCMData = reinterpret_cast<const float*>(DecodedData.PCMInfo.PCMData.GetView().GetData());
+	uint8* BlocksData = EncodedAudioData + HeaderSize;
+
+	// Blocks are independent of each other, so they are encoded in parallel. The blocks of all channels of the same frames are stored one after another
+	const int32 NumOfTasks = static_cast<int32>(FMath::DivideAndRoundUp<int64>(NumOfBlocks, BlocksPerTask));
+	ParallelFor(NumOfTasks, [&](int32 TaskIndex)
+	{
+		float BlockSamples[FramesPerBlock];
+
+		const int64 FirstBlockIndex = static_cast<int64>(TaskIndex) * BlocksPerTask;
+		const int64 LastBlockIndex = FMath::Min<int64>(FirstBlockIndex + BlocksPerTask, NumOfBlocks);
+
+		for (int64 BlockIndex = FirstBlockIndex; BlockIndex < LastBlockIndex; ++BlockIndex)
+		{
+			const int64 FirstFrameIndex = BlockIndex * FramesPerBlock;
+			const int32 NumOfBlockFrames = static_cast<int32>(FMath::Min<int64>(FramesPerBlock, NumOfFrames - FirstFrameIndex));
+
+			for (int32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+			{
+				// Deinterleaving the channel and converting it to the 16-bit range the same way as the uncompressed export. The tail of the last block is padded with silence
+				const float* ChannelData = PCMData + FirstFrameIndex * NumOfChannels + ChannelIndex;
+				for (int32 FrameIndex = 0; FrameIndex < NumOfBlockFrames; ++FrameIndex)
+				{
+					BlockSamples[FrameIndex] = RAWTranscoder::TranscodeRAWSample<float, int16>(ChannelData[FrameIndex * NumOfChannels]);
+				}
+				FMemory::Memzero(BlockSamples + NumOfBlockFrames, (FramesPerBlock - NumOfBlockFrames) * sizeof(float));
+
+				EncodeBlock(BlockSamples, BlocksData + (BlockIndex * NumOfChannels + ChannelIndex) * BlockSize);
+			}
+		}
+	});
+
+	{
+		EncodedData.AudioData = FBulkDataBuffer<uint8>(EncodedAudioData, EncodedDataSize);
+		EncodedData.AudioFormat = EAudioFormat::Wav;
+	}
+
+	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Successfully encoded uncompressed audio data to ADPCM audio format.\nEncoded audio info: %s"), *EncodedData.ToString()));
+
+	return true;
+}
@@ -0,0 +1,17 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDecodedAudioStruct;
+struct FEncodedAudioStruct;
+
+class RUNTIMEAUDIOIMPORTER_API ADPCMTranscoder
+{
+public:
+	/**
+	 * Encode uncompressed data to 4-bit Microsoft ADPCM in a WAV container, laid out the way the engine's real-time ADPCM decoder expects (fixed-size blocks of a single channel)
+	 */
+	static bool Encode(const FDecodedAudioStruct& DecodedData, FEncodedAudioStruct& EncodedData);
+};
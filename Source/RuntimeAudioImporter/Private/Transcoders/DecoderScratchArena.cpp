@@ -0,0 +1,171 @@
+// Georgy Treshchev 2022.
+
+#include "Transcoders/DecoderScratchArena.h"
+
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	/** Alignment of the allocations */
+	constexpr SIZE_T AllocationAlignment = 16;
+
+	/** Size of the header stored before each allocation. It holds the size of the allocation and keeps the memory aligned */
+	constexpr SIZE_T AllocationHeaderSize = AllocationAlignment;
+
+	/** Minimum size of a block. Enough for the decoder states of dr_libs and the setup memory of most Vorbis streams */
+	constexpr SIZE_T MinBlockSize = 256 * 1024;
+
+	/** Maximum size of the memory kept by the arena of a thread between jobs, in kilobytes */
+	int32 MaxRetainedSizeKB = static_cast<int32>(MinBlockSize / 1024);
+
+	FAutoConsoleVariableRef CVarMaxRetainedSizeKB(
+		TEXT("au.RuntimeAudioImporter.DecoderScratchRetainedKB"),
+		MaxRetainedSizeKB,
+		TEXT("Maximum size of the decoder scratch memory kept by each thread between decoding jobs, in kilobytes. Memory a job needed beyond it is freed once the job ends.\n")
+		TEXT("256: keep a single minimum-sized block (default)"),
+		ECVF_Default);
+
+	/**
+	 * Get the size of the allocation from its header
+	 */
+	SIZE_T& GetAllocationSize(void* Allocation)
+	{
+		return *reinterpret_cast<SIZE_T*>(static_cast<uint8*>(Allocation) - AllocationHeaderSize);
+	}
+}
+
+FDecoderScratchArena::FScope::FScope()
+	: Arena(FDecoderScratchArena::Get())
+{
+	++Arena.NumOfScopes;
+}
+
+FDecoderScratchArena::FScope::~FScope()
+{
+	if (--Arena.NumOfScopes == 0)
+	{
+		Arena.Reset();
+	}
+}
+
+FDecoderScratchArena& FDecoderScratchArena::Get()
+{
+	static thread_local FDecoderScratchArena Arena;
+	return Arena;
+}
+
+void* FDecoderScratchArena::Allocate(SIZE_T Size)
+{
+	const SIZE_T RequiredSize = AllocationHeaderSize + Align(Size, AllocationAlignment);
+
+	if (Blocks.Num() == 0 || Blocks.Last().Size - Blocks.Last().Offset < RequiredSize)
+	{
+		// Chaining a new block, at least twice as large as the previous one to keep the number of blocks small
+		const SIZE_T BlockSize = FMath::Max3(MinBlockSize, RequiredSize, Blocks.Num() > 0 ? Blocks.Last().Size * 2 : 0);
+
+		FBlock Block;
+		Block.Data = static_cast<uint8*>(FMemory::Malloc(BlockSize, AllocationAlignment));
+		Block.Size = BlockSize;
+		Blocks.Add(Block);
+	}
+
+	FBlock& Block = Blocks.Last();
+
+	uint8* Allocation = Block.Data + Block.Offset + AllocationHeaderSize;
+	Block.Offset += RequiredSize;
+
+	GetAllocationSize(Allocation) = Size;
+
+	return Allocation;
+}
+
+void* FDecoderScratchArena::Reallocate(void* Original, SIZE_T Size)
+{
+	if (Original == nullptr)
+	{
+		return Allocate(Size);
+	}
+
+	SIZE_T& OriginalSize = GetAllocationSize(Original);
+	FBlock& Block = Blocks.Last();
+
+	// Growing or shrinking the last allocation in place
+	if (static_cast<uint8*>(Original) + Align(OriginalSize, AllocationAlignment) == Block.Data + Block.Offset)
+	{
+		const SIZE_T AllocationOffset = static_cast<uint8*>(Original) - Block.Data;
+		const SIZE_T RequiredOffset = AllocationOffset + Align(Size, AllocationAlignment);
+
+		if (RequiredOffset <= Block.Size)
+		{
+			Block.Offset = RequiredOffset;
+			OriginalSize = Size;
+			return Original;
+		}
+	}
+
+	void* Reallocated = Allocate(Size);
+	FMemory::Memcpy(Reallocated, Original, FMath::Min(OriginalSize, Size));
+
+	return Reallocated;
+}
+
+void FDecoderScratchArena::Free(void* Original)
+{
+	if (Original == nullptr || Blocks.Num() == 0)
+	{
+		return;
+	}
+
+	FBlock& Block = Blocks.Last();
+	const SIZE_T AlignedSize = Align(GetAllocationSize(Original), AllocationAlignment);
+
+	// Returning the last allocation to the arena right away, e.g. a buffer that turned out to be too small
+	if (static_cast<uint8*>(Original) + AlignedSize == Block.Data + Block.Offset)
+	{
+		Block.Offset -= AllocationHeaderSize + AlignedSize;
+	}
+}
+
+void FDecoderScratchArena::Reset()
+{
+	if (Blocks.Num() == 0)
+	{
+		return;
+	}
+
+	const SIZE_T MaxRetainedSize = static_cast<SIZE_T>(FMath::Max(MaxRetainedSizeKB, 0)) * 1024;
+
+	if (Blocks.Num() == 1 && Blocks[0].Size <= MaxRetainedSize)
+	{
+		Blocks[0].Offset = 0;
+		return;
+	}
+
+	SIZE_T TotalSize = 0;
+	for (const FBlock& Block : Blocks)
+	{
+		TotalSize += Block.Size;
+		FMemory::Free(Block.Data);
+	}
+
+	Blocks.Reset();
+
+	// Merging the chained blocks into a single block if it fits the retained size. A job that needed more (e.g. a Vorbis stream with large setup memory) is not allowed to pin its peak usage to the thread
+	const SIZE_T RetainedSize = TotalSize <= MaxRetainedSize ? TotalSize : (MinBlockSize <= MaxRetainedSize ? MinBlockSize : 0);
+
+	if (RetainedSize > 0)
+	{
+		FBlock Block;
+		Block.Data = static_cast<uint8*>(FMemory::Malloc(RetainedSize, AllocationAlignment));
+		Block.Size = RetainedSize;
+		Blocks.Add(Block);
+	}
+}
+
+FDecoderScratchArena::~FDecoderScratchArena()
+{
+	for (const FBlock& Block : Blocks)
+	{
+		FMemory::Free(Block.Data);
+	}
+}
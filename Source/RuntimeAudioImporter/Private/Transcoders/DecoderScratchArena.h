@@ -0,0 +1,105 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Linear arena for the scratch memory of the third-party decoders (decoder states, metadata, stb_vorbis setup and temporary memory)
+ * Allocations only bump a pointer and freeing is deferred until the outermost scope of the thread ends, so a decoding job makes only a few general heap round trips
+ * Each thread has its own arena, which keeps up to au.RuntimeAudioImporter.DecoderScratchRetainedKB of its memory between jobs
+ */
+class FDecoderScratchArena
+{
+public:
+	/**
+	 * Scope of a decoding job. The arena of the calling thread is reset once the outermost scope ends, so all decoders using it must be closed by then
+	 */
+	class FScope
+	{
+	public:
+		FScope();
+		~FScope();
+
+		/** The arena of the calling thread */
+		FDecoderScratchArena& Arena;
+	};
+
+	/**
+	 * Get the arena of the calling thread
+	 */
+	static FDecoderScratchArena& Get();
+
+	/**
+	 * Allocate memory from the arena. The memory is aligned to 16 bytes
+	 *
+	 * @param Size Size of the memory to allocate, in bytes
+	 * @return Pointer to the allocated memory
+	 */
+	void* Allocate(SIZE_T Size);
+
+	/**
+	 * Reallocate memory previously allocated from the arena. The last allocation is grown in place when possible
+	 *
+	 * @param Original Pointer to the previously allocated memory, or nullptr
+	 * @param Size New size of the memory, in bytes
+	 * @return Pointer to the reallocated memory
+	 */
+	void* Reallocate(void* Original, SIZE_T Size);
+
+	/**
+	 * Free memory previously allocated from the arena. Only the last allocation is actually returned to the arena, the rest is returned when the arena is reset
+	 *
+	 * @param Original Pointer to the previously allocated memory, or nullptr
+	 */
+	void Free(void* Original);
+
+	/**
+	 * Get the allocation callbacks of dr_libs (drmp3_allocation_callbacks, drwav_allocation_callbacks or drflac_allocation_callbacks) that allocate from this arena
+	 */
+	template <typename AllocationCallbacksType>
+	AllocationCallbacksType GetAllocationCallbacks()
+	{
+		AllocationCallbacksType AllocationCallbacks;
+
+		AllocationCallbacks.pUserData = this;
+		AllocationCallbacks.onMalloc = [](size_t Size, void* UserData) -> void*
+		{
+			return static_cast<FDecoderScratchArena*>(UserData)->Allocate(Size);
+		};
+		AllocationCallbacks.onRealloc = [](void* Original, size_t Size, void* UserData) -> void*
+		{
+			return static_cast<FDecoderScratchArena*>(UserData)->Reallocate(Original, Size);
+		};
+		AllocationCallbacks.onFree = [](void* Original, void* UserData)
+		{
+			static_cast<FDecoderScratchArena*>(UserData)->Free(Original);
+		};
+
+		return AllocationCallbacks;
+	}
+
+	~FDecoderScratchArena();
+
+private:
+	FDecoderScratchArena() = default;
+
+	/** Block of memory allocations are bumped from */
+	struct FBlock
+	{
+		uint8* Data = nullptr;
+		SIZE_T Size = 0;
+		SIZE_T Offset = 0;
+	};
+
+	/**
+	 * Return all allocations to the arena. Blocks that were chained during the job are merged into a single block to serve the next job without chaining, as long as it fits the retained size
+	 */
+	void Reset();
+
+	/** Blocks of the arena, the last one is the one allocations are bumped from */
+	TArray<FBlock> Blocks;
+
+	/** Number of active scopes */
+	int32 NumOfScopes = 0;
+};
@@ -1,6 +1,7 @@
 ﻿// Georgy Treshchev 2022.
 
 #include "Transcoders/FlacTranscoder.h"
+#include "Transcoders/DecoderScratchArena.h"
 #include "RuntimeAudioImporterDefines.h"
 #include "RuntimeAudioImporterTypes.h"
 
@@ -10,22 +11,55 @@
 
 bool FlacTranscoder::CheckAudioFormat(const uint8* AudioData, int32 AudioDataSize)
 {
-	drflac* FLAC{drflac_open_memory(AudioData, AudioDataSize, nullptr)};
+	FDecoderScratchArena::FScope ArenaScope;
+	const drflac_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drflac_allocation_callbacks>()};
+
+	drflac* FLAC{drflac_open_memory(AudioData, AudioDataSize, &AllocationCallbacks)};
+
+	if (FLAC == nullptr)
+	{
+		return false;
+	}
+
+	drflac_close(FLAC);
+
+	return true;
+}
+
+bool FlacTranscoder::GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, FSoundWaveBasicStruct& BasicInfo)
+{
+	FDecoderScratchArena::FScope ArenaScope;
+	const drflac_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drflac_allocation_callbacks>()};
+
+	drflac* FLAC{drflac_open_memory(AudioData, AudioDataSize, &AllocationCallbacks)};
 
 	if (FLAC == nullptr)
 	{
 		return false;
 	}
 
+	// The length is read from the STREAMINFO block
+	BasicInfo.Duration = static_cast<float>(FLAC->totalPCMFrameCount) / FLAC->sampleRate;
+	BasicInfo.NumOfChannels = FLAC->channels;
+	BasicInfo.SampleRate = FLAC->sampleRate;
+
+	drflac_close(FLAC);
+
 	return true;
 }
 
-bool FlacTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData)
+bool FlacTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData, const FOnDecodingProgress& OnProgress)
 {
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("FlacTranscoder::Decode", EncodedData.AudioData.GetView().Num());
+
 	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Decoding Flac audio data to uncompressed audio format.\nEncoded audio info: %s"), *EncodedData.ToString()));
 	
+	// The decoder state is allocated from the scratch arena of the thread
+	FDecoderScratchArena::FScope ArenaScope;
+	const drflac_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drflac_allocation_callbacks>()};
+
 	// Initializing transcoding of audio data in memory
-	drflac* FLAC_Decoder{drflac_open_memory(EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), nullptr)};
+	drflac* FLAC_Decoder{drflac_open_memory(EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), &AllocationCallbacks)};
 
 	if (FLAC_Decoder == nullptr)
 	{
@@ -37,12 +71,15 @@ bool FlacTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudi
 	uint8* TempPCMData = static_cast<uint8*>(FMemory::Malloc(FLAC_Decoder->totalPCMFrameCount * FLAC_Decoder->channels * sizeof(float)));
 
 	// Filling in PCM data and getting the number of frames
-	DecodedData.PCMInfo.PCMNumOfFrames = drflac_read_pcm_frames_f32(FLAC_Decoder, FLAC_Decoder->totalPCMFrameCount, reinterpret_cast<float*>(TempPCMData));
+	DecodedData.PCMInfo.PCMNumOfFrames = RuntimeAudioImporter_Decoding::ReadFramesInChunks(FLAC_Decoder->totalPCMFrameCount, FLAC_Decoder->channels, reinterpret_cast<float*>(TempPCMData), OnProgress, [FLAC_Decoder](uint64 NumOfFrames, float* OutData)
+	{
+		return drflac_read_pcm_frames_f32(FLAC_Decoder, NumOfFrames, OutData);
+	});
 
 	// Getting PCM data size
 	const int32 TempPCMDataSize = static_cast<int32>(DecodedData.PCMInfo.PCMNumOfFrames * FLAC_Decoder->channels * sizeof(float));
 
-	DecodedData.PCMInfo.PCMData = FBulkDataBuffer<uint8>(TempPCMData, TempPCMDataSize);
+	DecodedData.PCMInfo.PCMData = FSharedPCMBuffer(TempPCMData, TempPCMDataSize);
 
 	// Getting basic audio information
 	{
@@ -1,6 +1,7 @@
 ﻿// Georgy Treshchev 2022.
 
 #include "Transcoders/MP3Transcoder.h"
+#include "Transcoders/DecoderScratchArena.h"
 #include "RuntimeAudioImporterDefines.h"
 #include "RuntimeAudioImporterTypes.h"
 
@@ -10,43 +11,84 @@
 
 bool MP3Transcoder::CheckAudioFormat(const uint8* AudioData, int32 AudioDataSize)
 {
+	FDecoderScratchArena::FScope ArenaScope;
+	const drmp3_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drmp3_allocation_callbacks>()};
+
 	drmp3 MP3;
 	
-	if (!drmp3_init_memory(&MP3, AudioData, AudioDataSize, nullptr))
+	if (!drmp3_init_memory(&MP3, AudioData, AudioDataSize, &AllocationCallbacks))
+	{
+		return false;
+	}
+
+	drmp3_uninit(&MP3);
+
+	return true;
+}
+
+bool MP3Transcoder::GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, FSoundWaveBasicStruct& BasicInfo)
+{
+	FDecoderScratchArena::FScope ArenaScope;
+	const drmp3_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drmp3_allocation_callbacks>()};
+
+	drmp3 MP3;
+
+	if (!drmp3_init_memory(&MP3, AudioData, AudioDataSize, &AllocationCallbacks))
 	{
 		return false;
 	}
 
+	// MP3 has no header with the length, so the frames are counted by parsing them, without synthesizing the samples
+	const drmp3_uint64 TotalNumOfFrames = drmp3_get_pcm_frame_count(&MP3);
+
+	BasicInfo.Duration = static_cast<float>(TotalNumOfFrames) / MP3.sampleRate;
+	BasicInfo.NumOfChannels = MP3.channels;
+	BasicInfo.SampleRate = MP3.sampleRate;
+
+	drmp3_uninit(&MP3);
+
 	return true;
 }
 
-bool MP3Transcoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData)
+bool MP3Transcoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData, const FOnDecodingProgress& OnProgress)
 {
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("MP3Transcoder::Decode", EncodedData.AudioData.GetView().Num());
+
 	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Decoding MP3 audio data to uncompressed audio format.\nEncoded audio info: %s"), *EncodedData.ToString()));
 	
+	// The decoder state is allocated from the scratch arena of the thread
+	FDecoderScratchArena::FScope ArenaScope;
+	const drmp3_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drmp3_allocation_callbacks>()};
+
 	drmp3 MP3_Decoder;
 
 	// Initializing transcoding of audio data in memory
-	if (!drmp3_init_memory(&MP3_Decoder, EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), nullptr))
+	if (!drmp3_init_memory(&MP3_Decoder, EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), &AllocationCallbacks))
 	{
 		RuntimeAudioImporter_TranscoderLogs::PrintError(TEXT("Unable to initialize MP3 Decoder"));
 		return false;
 	}
 
+	// Counting the frames requires scanning the whole stream, so it is done only once
+	const drmp3_uint64 TotalNumOfFrames = drmp3_get_pcm_frame_count(&MP3_Decoder);
+
 	// Allocating memory for PCM data
-	uint8* TempPCMData = static_cast<uint8*>(FMemory::Malloc(drmp3_get_pcm_frame_count(&MP3_Decoder) * MP3_Decoder.channels * sizeof(float)));
+	uint8* TempPCMData = static_cast<uint8*>(FMemory::Malloc(TotalNumOfFrames * MP3_Decoder.channels * sizeof(float)));
 
 	// Filling in PCM data and getting the number of frames
-	DecodedData.PCMInfo.PCMNumOfFrames = drmp3_read_pcm_frames_f32(&MP3_Decoder, drmp3_get_pcm_frame_count(&MP3_Decoder), reinterpret_cast<float*>(TempPCMData));
+	DecodedData.PCMInfo.PCMNumOfFrames = RuntimeAudioImporter_Decoding::ReadFramesInChunks(TotalNumOfFrames, MP3_Decoder.channels, reinterpret_cast<float*>(TempPCMData), OnProgress, [&MP3_Decoder](uint64 NumOfFrames, float* OutData)
+	{
+		return drmp3_read_pcm_frames_f32(&MP3_Decoder, NumOfFrames, OutData);
+	});
 
 	// Getting PCM data size
 	const int32 TempPCMDataSize = static_cast<int32>(DecodedData.PCMInfo.PCMNumOfFrames * MP3_Decoder.channels * sizeof(float));
 
-	DecodedData.PCMInfo.PCMData = FBulkDataBuffer<uint8>(TempPCMData, TempPCMDataSize);
+	DecodedData.PCMInfo.PCMData = FSharedPCMBuffer(TempPCMData, TempPCMDataSize);
 
 	// Getting basic audio information
 	{
-		DecodedData.SoundWaveBasicInfo.Duration = static_cast<float>(drmp3_get_pcm_frame_count(&MP3_Decoder)) / MP3_Decoder.sampleRate;
+		DecodedData.SoundWaveBasicInfo.Duration = static_cast<float>(TotalNumOfFrames) / MP3_Decoder.sampleRate;
 		DecodedData.SoundWaveBasicInfo.NumOfChannels = MP3_Decoder.channels;
 		DecodedData.SoundWaveBasicInfo.SampleRate = MP3_Decoder.sampleRate;
 	}
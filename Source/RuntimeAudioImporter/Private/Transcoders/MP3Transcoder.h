@@ -3,9 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RuntimeAudioImporterDefines.h"
 
 struct FDecodedAudioStruct;
 struct FEncodedAudioStruct;
+struct FSoundWaveBasicStruct;
 
 class RUNTIMEAUDIOIMPORTER_API MP3Transcoder
 {
@@ -13,7 +15,12 @@ public:
 	static bool CheckAudioFormat(const uint8* AudioData, int32 AudioDataSize);
 
 	/**
-	 * Decode compressed MP3 data to PCM format
+	 * Get the basic information (e.g. duration, number of channels, etc) of the MP3 audio data from its headers, without decoding it
 	 */
-	static bool Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData);
+	static bool GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, FSoundWaveBasicStruct& BasicInfo);
+
+	/**
+	 * Decode compressed MP3 data to PCM format, reporting the progress after each decoded chunk
+	 */
+	static bool Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData, const FOnDecodingProgress& OnProgress = nullptr);
 };
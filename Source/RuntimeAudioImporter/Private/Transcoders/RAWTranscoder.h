@@ -20,7 +20,7 @@ public:
 		/** Signed 16-bit PCM */
 		if (TIsSame<IntegralType, int16>::Value)
 		{
-			return TTuple<float, float>(-32767, 32768);
+			return TTuple<float, float>(-32768, 32767);
 		}
 
 		/** Signed 32-bit PCM */
@@ -44,6 +44,23 @@ public:
 		return TTuple<float, float>(-1.0, 1.0);
 	}
 
+	/**
+	 * Transcoding a single RAW sample to another format
+	 *
+	 * @note Same mapping as FMath::GetMappedRangeValueClamped, folded into a scale and an offset. The result is clamped with FMath::Min and FMath::Max rather than FMath::Clamp, whose nested conditional keeps the compiler from vectorizing transcoding loops
+	 */
+	template <typename IntegralTypeFrom, typename IntegralTypeTo>
+	static IntegralTypeTo TranscodeRAWSample(IntegralTypeFrom Sample)
+	{
+		const TTuple<float, float> MinAndMaxValuesFrom{GetRawMinAndMaxValues<IntegralTypeFrom>()};
+		const TTuple<float, float> MinAndMaxValuesTo{GetRawMinAndMaxValues<IntegralTypeTo>()};
+
+		const float Scale = (MinAndMaxValuesTo.Value - MinAndMaxValuesTo.Key) / (MinAndMaxValuesFrom.Value - MinAndMaxValuesFrom.Key);
+		const float Offset = MinAndMaxValuesTo.Key - MinAndMaxValuesFrom.Key * Scale;
+
+		return static_cast<IntegralTypeTo>(FMath::Min(FMath::Max(static_cast<float>(Sample) * Scale + Offset, MinAndMaxValuesTo.Key), MinAndMaxValuesTo.Value));
+	}
+
 	/**
 	 * Transcoding one RAW Data format to another
 	 *
@@ -62,6 +79,7 @@ public:
 		TranscodeRAWData<IntegralTypeFrom, IntegralTypeTo>(DataFrom, DataFrom_Size, DataTo, DataTo_Size);
 
 		RAWData_To = TArray<uint8>(reinterpret_cast<uint8*>(DataTo), DataTo_Size);
+		FMemory::Free(DataTo);
 	}
 
 	/**
@@ -75,22 +93,32 @@ public:
 	template <typename IntegralTypeFrom, typename IntegralTypeTo>
 	static void TranscodeRAWData(IntegralTypeFrom* RAWData_From, int32 RAWDataSize_From, IntegralTypeTo*& RAWData_To, int32& RAWDataSize_To)
 	{
+		SCOPE_CYCLE_COUNTER(STAT_RuntimeAudioImporter_TranscodeRAW);
+		RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("RAWTranscoder::TranscodeRAWData", RAWDataSize_From);
+
 		/** Getting the required number of samples to transcode */
 		const int32 NumSamples = RAWDataSize_From / sizeof(IntegralTypeFrom);
 
 		/** Getting the required PCM size */
 		RAWDataSize_To = NumSamples * sizeof(IntegralTypeTo);
 
-		/** Creating an empty PCM buffer */
-		IntegralTypeTo* TempPCMData = static_cast<IntegralTypeTo*>(FMemory::MallocZeroed(RAWDataSize_To));
+		/** Creating a PCM buffer. Every sample is written below, so it is not zeroed */
+		IntegralTypeTo* TempPCMData = static_cast<IntegralTypeTo*>(FMemory::Malloc(RAWDataSize_To));
 
 		const TTuple<float, float> MinAndMaxValuesFrom{GetRawMinAndMaxValues<IntegralTypeFrom>()};
 		const TTuple<float, float> MinAndMaxValuesTo{GetRawMinAndMaxValues<IntegralTypeTo>()};
 
-		/** Iterating through the RAW Data to transcode values using a divisor */
-		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		if (TIsSame<IntegralTypeFrom, IntegralTypeTo>::Value && !TIsSame<IntegralTypeFrom, float>::Value)
+		{
+			/** The ranges are the same, so the integral samples are copied as is */
+			FMemory::Memcpy(TempPCMData, RAWData_From, RAWDataSize_To);
+		}
+		else
 		{
-			TempPCMData[SampleIndex] = static_cast<IntegralTypeTo>(FMath::GetMappedRangeValueClamped(FVector2D(MinAndMaxValuesFrom.Key, MinAndMaxValuesFrom.Value), FVector2D(MinAndMaxValuesTo.Key, MinAndMaxValuesTo.Value), RAWData_From[SampleIndex]));
+			for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+			{
+				TempPCMData[SampleIndex] = TranscodeRAWSample<IntegralTypeFrom, IntegralTypeTo>(RAWData_From[SampleIndex]);
+			}
 		}
 
 		/** Returning the transcoded data as bytes */
@@ -3,16 +3,52 @@
 #include "VorbisTranscoder.h"
 #include "RuntimeAudioImporterTypes.h"
 #include "Transcoders/RAWTranscoder.h"
+#include "Transcoders/DecoderScratchArena.h"
 #include "GenericPlatform/GenericPlatformProperties.h"
 
 #define INCLUDE_VORBIS
 #include "TranscodersIncludes.h"
 #undef INCLUDE_VORBIS
 
+namespace
+{
+	/** Initial size of the buffer stb_vorbis allocates all its memory from. Enough for most streams */
+	constexpr int32 InitialAllocBufferSize = 256 * 1024;
+
+	/** Maximum size of the buffer stb_vorbis allocates all its memory from */
+	constexpr int32 MaxAllocBufferSize = 16 * 1024 * 1024;
+
+	/**
+	 * Open the stb_vorbis decoder with all its setup and temporary memory allocated from the scratch arena. stb_vorbis cannot report the required size in advance, so the buffer is grown until it fits
+	 */
+	stb_vorbis* OpenVorbisDecoder(FDecoderScratchArena& Arena, const uint8* AudioData, int32 AudioDataSize, int32& ErrorCode)
+	{
+		for (int32 AllocBufferSize = InitialAllocBufferSize; AllocBufferSize <= MaxAllocBufferSize; AllocBufferSize *= 2)
+		{
+			stb_vorbis_alloc AllocBuffer;
+			AllocBuffer.alloc_buffer = static_cast<char*>(Arena.Allocate(AllocBufferSize));
+			AllocBuffer.alloc_buffer_length_in_bytes = AllocBufferSize;
+
+			stb_vorbis* Vorbis_Decoder = stb_vorbis_open_memory(AudioData, AudioDataSize, &ErrorCode, &AllocBuffer);
+
+			if (Vorbis_Decoder != nullptr || ErrorCode != VORBIS_outofmem)
+			{
+				return Vorbis_Decoder;
+			}
+
+			Arena.Free(AllocBuffer.alloc_buffer);
+		}
+
+		return nullptr;
+	}
+}
+
 bool VorbisTranscoder::CheckAudioFormat(const uint8* AudioData, int32 AudioDataSize)
 {
+	FDecoderScratchArena::FScope ArenaScope;
+
 	int32 ErrorCode;
-	stb_vorbis* STBVorbis = stb_vorbis_open_memory(AudioData, AudioDataSize, &ErrorCode, nullptr);
+	stb_vorbis* STBVorbis = OpenVorbisDecoder(ArenaScope.Arena, AudioData, AudioDataSize, ErrorCode);
 
 	if (STBVorbis == nullptr)
 	{
@@ -20,11 +56,39 @@ bool VorbisTranscoder::CheckAudioFormat(const uint8* AudioData, int32 AudioDataS
 		return false;
 	}
 
+	stb_vorbis_close(STBVorbis);
+
+	return true;
+}
+
+bool VorbisTranscoder::GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, FSoundWaveBasicStruct& BasicInfo)
+{
+	FDecoderScratchArena::FScope ArenaScope;
+
+	int32 ErrorCode;
+	stb_vorbis* Vorbis_Decoder = OpenVorbisDecoder(ArenaScope.Arena, AudioData, AudioDataSize, ErrorCode);
+
+	if (Vorbis_Decoder == nullptr)
+	{
+		return false;
+	}
+
+	// The length is read from the granule position of the last Ogg page
+	const uint32 StreamLengthInFrames = stb_vorbis_stream_length_in_samples(Vorbis_Decoder);
+
+	BasicInfo.Duration = StreamLengthInFrames != MAX_uint32 ? static_cast<float>(StreamLengthInFrames) / Vorbis_Decoder->sample_rate : 0.f;
+	BasicInfo.NumOfChannels = Vorbis_Decoder->channels;
+	BasicInfo.SampleRate = Vorbis_Decoder->sample_rate;
+
+	stb_vorbis_close(Vorbis_Decoder);
+
 	return true;
 }
 
 bool VorbisTranscoder::Encode(const FDecodedAudioStruct& DecodedData, FEncodedAudioStruct& EncodedData, uint8 Quality)
 {
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("VorbisTranscoder::Encode", DecodedData.PCMInfo.PCMData.GetView().Num());
+
 	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Encoding uncompressed audio data to Vorbis audio format.\nDecoded audio info: %s.\nQuality: %d"), *DecodedData.ToString(), Quality));
 	
 #if PLATFORM_SUPPORTS_VORBIS_CODEC
@@ -196,12 +260,17 @@ bool VorbisTranscoder::Encode(const FDecodedAudioStruct& DecodedData, FEncodedAu
 #endif
 }
 
-bool VorbisTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData)
+bool VorbisTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData, const FOnDecodingProgress& OnProgress)
 {
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("VorbisTranscoder::Decode", EncodedData.AudioData.GetView().Num());
+
 	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Decoding Vorbis audio data to uncompressed audio format.\nEncoded audio info: %s"), *EncodedData.ToString()));
 	
+	// All the memory of the decoder is allocated from the scratch arena of the thread
+	FDecoderScratchArena::FScope ArenaScope;
+
 	int32 ErrorCode;
-	stb_vorbis* Vorbis_Decoder = stb_vorbis_open_memory(EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), &ErrorCode, nullptr);
+	stb_vorbis* Vorbis_Decoder = OpenVorbisDecoder(ArenaScope.Arena, EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), ErrorCode);
 
 	if (Vorbis_Decoder == nullptr)
 	{
@@ -215,8 +284,17 @@ bool VorbisTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAu
 
 	int32 SamplesOffset = 0;
 	int32 NumOfFrames = 0;
+	uint64 NumOfFramesSinceProgress = 0;
 
+	// Sizing the buffer from the stream length found in the last Ogg page, so that it does not have to be grown while decoding a well-formed stream
 	int32 TotalSamples = SamplesLimit;
+	{
+		const uint32 StreamLengthInFrames = stb_vorbis_stream_length_in_samples(Vorbis_Decoder);
+		if (StreamLengthInFrames != 0 && StreamLengthInFrames != MAX_uint32 && static_cast<int64>(StreamLengthInFrames) * NumOfChannels + SamplesLimit <= MAX_int32)
+		{
+			TotalSamples = StreamLengthInFrames * NumOfChannels + SamplesLimit;
+		}
+	}
 
 	int16* Int16RAWBuffer = static_cast<int16*>(FMemory::Malloc(TotalSamples * sizeof(int16)));
 	if (Int16RAWBuffer == nullptr)
@@ -235,6 +313,14 @@ bool VorbisTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAu
 		NumOfFrames += CurrentFrames;
 		SamplesOffset += CurrentFrames * NumOfChannels;
 
+		// The total number of frames is not known in advance, so the progress is based on the number of consumed bytes
+		NumOfFramesSinceProgress += CurrentFrames;
+		if (OnProgress && NumOfFramesSinceProgress >= RuntimeAudioImporter_Decoding::NumOfFramesPerChunk)
+		{
+			NumOfFramesSinceProgress = 0;
+			OnProgress(static_cast<float>(stb_vorbis_get_file_offset(Vorbis_Decoder)) / EncodedData.AudioData.GetView().Num());
+		}
+
 		if (SamplesOffset + SamplesLimit > TotalSamples)
 		{
 			TotalSamples *= 2;
@@ -266,11 +352,11 @@ bool VorbisTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAu
 
 	// Transcoding int16 to float format
 	{
-		float* TempFloatBuffer = static_cast<float*>(FMemory::Malloc(DecodedData.PCMInfo.PCMNumOfFrames * NumOfChannels * 2 * sizeof(float)));
+		float* TempFloatBuffer = nullptr;
 		int32 TempFloatSize;
 
 		RAWTranscoder::TranscodeRAWData<int16, float>(Int16RAWBuffer, TempPCMDataSize, TempFloatBuffer, TempFloatSize);
-		DecodedData.PCMInfo.PCMData = FBulkDataBuffer<uint8>(reinterpret_cast<uint8*>(TempFloatBuffer), TempFloatSize);
+		DecodedData.PCMInfo.PCMData = FSharedPCMBuffer(reinterpret_cast<uint8*>(TempFloatBuffer), TempFloatSize);
 	}
 	
 	FMemory::Free(Int16RAWBuffer);
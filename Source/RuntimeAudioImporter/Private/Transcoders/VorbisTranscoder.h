@@ -3,9 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RuntimeAudioImporterDefines.h"
 
 struct FDecodedAudioStruct;
 struct FEncodedAudioStruct;
+struct FSoundWaveBasicStruct;
 
 class RUNTIMEAUDIOIMPORTER_API VorbisTranscoder
 {
@@ -15,13 +17,18 @@ public:
 	 */
 	static bool CheckAudioFormat(const uint8* AudioData, int32 AudioDataSize);
 
+	/**
+	 * Get the basic information (e.g. duration, number of channels, etc) of the Vorbis audio data from its headers, without decoding it
+	 */
+	static bool GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, FSoundWaveBasicStruct& BasicInfo);
+
 	/**
 	 * Encode uncompressed data to Vorbis format
 	 */
 	static bool Encode(const FDecodedAudioStruct& DecodedData, FEncodedAudioStruct& EncodedData, uint8 Quality);
 
 	/**
-	 * Decode compressed Vorbis data to PCM format
+	 * Decode compressed Vorbis data to PCM format, reporting the progress after each decoded chunk
 	 */
-	static bool Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData);
+	static bool Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData, const FOnDecodingProgress& OnProgress = nullptr);
 };
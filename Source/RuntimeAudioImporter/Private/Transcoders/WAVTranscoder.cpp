@@ -1,6 +1,7 @@
 ﻿// Georgy Treshchev 2022.
 
 #include "WAVTranscoder.h"
+#include "Transcoders/DecoderScratchArena.h"
 #include "RuntimeAudioImporterDefines.h"
 #include "RuntimeAudioImporterTypes.h"
 
@@ -10,10 +11,13 @@
 
 bool WAVTranscoder::CheckAndFixWavDurationErrors(TArray<uint8>& WavData)
 {
+	FDecoderScratchArena::FScope ArenaScope;
+	const drwav_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drwav_allocation_callbacks>()};
+
 	drwav WAV;
 
 	// Initializing transcoding of audio data in memory
-	if (!drwav_init_memory(&WAV, WavData.GetData(), WavData.Num(), nullptr))
+	if (!drwav_init_memory(&WAV, WavData.GetData(), WavData.Num(), &AllocationCallbacks))
 	{
 		RuntimeAudioImporter_TranscoderLogs::PrintError(TEXT("Unable to initialize WAV Decoder"));
 		return false;
@@ -72,13 +76,40 @@ bool WAVTranscoder::CheckAndFixWavDurationErrors(TArray<uint8>& WavData)
 
 bool WAVTranscoder::CheckAudioFormat(const uint8* AudioData, int32 AudioDataSize)
 {
+	FDecoderScratchArena::FScope ArenaScope;
+	const drwav_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drwav_allocation_callbacks>()};
+
 	drwav WAV;
 
-	if (!drwav_init_memory(&WAV, AudioData, AudioDataSize, nullptr))
+	if (!drwav_init_memory(&WAV, AudioData, AudioDataSize, &AllocationCallbacks))
 	{
 		return false;
 	}
 
+	drwav_uninit(&WAV);
+
+	return true;
+}
+
+bool WAVTranscoder::GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, FSoundWaveBasicStruct& BasicInfo)
+{
+	FDecoderScratchArena::FScope ArenaScope;
+	const drwav_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drwav_allocation_callbacks>()};
+
+	drwav WAV;
+
+	if (!drwav_init_memory(&WAV, AudioData, AudioDataSize, &AllocationCallbacks))
+	{
+		return false;
+	}
+
+	// The length is derived from the size of the "data" chunk
+	BasicInfo.Duration = static_cast<float>(WAV.totalPCMFrameCount) / WAV.sampleRate;
+	BasicInfo.NumOfChannels = WAV.channels;
+	BasicInfo.SampleRate = WAV.sampleRate;
+
+	drwav_uninit(&WAV);
+
 	return true;
 }
 
@@ -107,6 +138,8 @@ uint32 ConvertFormat(EWAVEncodingFormat Format)
 
 bool WAVTranscoder::Encode(const FDecodedAudioStruct& DecodedData, FEncodedAudioStruct& EncodedData, FWAVEncodingFormat Format)
 {
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("WAVTranscoder::Encode", DecodedData.PCMInfo.PCMData.GetView().Num());
+
 	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Encoding uncompressed audio data to WAV audio format.\nDecoded audio info: %s.\nEncoding audio format: %s"),
 	                                                                *DecodedData.ToString(), *Format.ToString()));
 
@@ -143,14 +176,20 @@ bool WAVTranscoder::Encode(const FDecodedAudioStruct& DecodedData, FEncodedAudio
 	return true;
 }
 
-bool WAVTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData)
+bool WAVTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData, const FOnDecodingProgress& OnProgress)
 {
+	RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED("WAVTranscoder::Decode", EncodedData.AudioData.GetView().Num());
+
 	RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Decoding WAV audio data to uncompressed audio format.\nEncoded audio info: %s"), *EncodedData.ToString()));
 
+	// The decoder state and the metadata are allocated from the scratch arena of the thread
+	FDecoderScratchArena::FScope ArenaScope;
+	const drwav_allocation_callbacks AllocationCallbacks{ArenaScope.Arena.GetAllocationCallbacks<drwav_allocation_callbacks>()};
+
 	drwav WAV_Decoder;
 
-	// Initializing transcoding of audio data in memory
-	if (!drwav_init_memory(&WAV_Decoder, EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), nullptr))
+	// Initializing transcoding of audio data in memory. Metadata is parsed to retrieve the loop points
+	if (!drwav_init_memory_with_metadata(&WAV_Decoder, EncodedData.AudioData.GetView().GetData(), EncodedData.AudioData.GetView().Num(), 0, &AllocationCallbacks))
 	{
 		RuntimeAudioImporter_TranscoderLogs::PrintError(TEXT("Unable to initialize WAV Decoder"));
 		return false;
@@ -160,12 +199,15 @@ bool WAVTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudio
 	uint8* TempPCMData = static_cast<uint8*>(FMemory::Malloc(WAV_Decoder.totalPCMFrameCount * WAV_Decoder.channels * sizeof(float)));
 
 	// Filling PCM data and getting the number of frames
-	DecodedData.PCMInfo.PCMNumOfFrames = drwav_read_pcm_frames_f32(&WAV_Decoder, WAV_Decoder.totalPCMFrameCount, reinterpret_cast<float*>(TempPCMData));
+	DecodedData.PCMInfo.PCMNumOfFrames = RuntimeAudioImporter_Decoding::ReadFramesInChunks(WAV_Decoder.totalPCMFrameCount, WAV_Decoder.channels, reinterpret_cast<float*>(TempPCMData), OnProgress, [&WAV_Decoder](uint64 NumOfFrames, float* OutData)
+	{
+		return drwav_read_pcm_frames_f32(&WAV_Decoder, NumOfFrames, OutData);
+	});
 
 	// Getting PCM data size
 	const int32 TempPCMDataSize = static_cast<int32>(DecodedData.PCMInfo.PCMNumOfFrames * WAV_Decoder.channels * sizeof(float));
 
-	DecodedData.PCMInfo.PCMData =FBulkDataBuffer<uint8>(TempPCMData, TempPCMDataSize);
+	DecodedData.PCMInfo.PCMData = FSharedPCMBuffer(TempPCMData, TempPCMDataSize);
 
 	// Getting basic audio information
 	{
@@ -174,6 +216,27 @@ bool WAVTranscoder::Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudio
 		DecodedData.SoundWaveBasicInfo.SampleRate = WAV_Decoder.sampleRate;
 	}
 
+	// Getting the first loop of the "smpl" chunk. Despite the field names, the offsets are sample frame indices and the last frame is inclusive
+	for (drwav_uint32 MetadataIndex = 0; MetadataIndex < WAV_Decoder.metadataCount; ++MetadataIndex)
+	{
+		const drwav_metadata& Metadata = WAV_Decoder.pMetadata[MetadataIndex];
+
+		if (Metadata.type != drwav_metadata_type_smpl || Metadata.data.smpl.sampleLoopCount == 0 || Metadata.data.smpl.pLoops == nullptr)
+		{
+			continue;
+		}
+
+		const drwav_smpl_loop& Loop = Metadata.data.smpl.pLoops[0];
+
+		if (Loop.firstSampleByteOffset <= Loop.lastSampleByteOffset && Loop.lastSampleByteOffset < DecodedData.PCMInfo.PCMNumOfFrames)
+		{
+			DecodedData.LoopRegion = FLoopRegionStruct{Loop.firstSampleByteOffset, Loop.lastSampleByteOffset + 1};
+			RuntimeAudioImporter_TranscoderLogs::PrintLog(FString::Printf(TEXT("Found a loop region in the WAV audio data. %s"), *DecodedData.LoopRegion->ToString()));
+		}
+
+		break;
+	}
+
 	// Uninitializing transcoding of audio data in memory
 	drwav_uninit(&WAV_Decoder);
 	
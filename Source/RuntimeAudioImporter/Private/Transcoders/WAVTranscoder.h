@@ -3,9 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RuntimeAudioImporterDefines.h"
 
 struct FDecodedAudioStruct;
 struct FEncodedAudioStruct;
+struct FSoundWaveBasicStruct;
 
 /**
  * All possible WAV formats
@@ -63,13 +65,18 @@ public:
 	 */
 	static bool CheckAudioFormat(const uint8* AudioData, int32 AudioDataSize);
 
+	/**
+	 * Get the basic information (e.g. duration, number of channels, etc) of the WAV audio data from its headers, without decoding it
+	 */
+	static bool GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, FSoundWaveBasicStruct& BasicInfo);
+
 	/**
 	 * Encode uncompressed data to WAV format
 	 */
 	static bool Encode(const FDecodedAudioStruct& DecodedData, FEncodedAudioStruct& EncodedData, FWAVEncodingFormat Format);
 
 	/**
-	 * Decode compressed WAV data to PCM format
+	 * Decode compressed WAV data to PCM format, reporting the progress after each decoded chunk
 	 */
-	static bool Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData);
+	static bool Decode(const FEncodedAudioStruct& EncodedData, FDecodedAudioStruct& DecodedData, const FOnDecodingProgress& OnProgress = nullptr);
 };
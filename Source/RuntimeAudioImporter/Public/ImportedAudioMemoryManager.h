@@ -0,0 +1,61 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UImportedSoundWave;
+
+/**
+ * Tracks the PCM data of all imported sound waves and keeps its total size within the budget set by the "au.RuntimeAudioImporter.MemoryBudgetMB" console variable
+ * When the budget is exceeded, the PCM data of the least recently played sound waves is evicted. It is re-decoded from the retained encoded audio data the next time the sound wave is played
+ * Game thread only
+ */
+class RUNTIMEAUDIOIMPORTER_API FImportedAudioMemoryManager
+{
+public:
+	/**
+	 * Get the memory manager instance
+	 */
+	static FImportedAudioMemoryManager& Get();
+
+	/**
+	 * Start tracking the PCM data of the sound wave and enforce the budget. Does nothing if the sound wave is already tracked, except for enforcing the budget
+	 *
+	 * @param SoundWave The sound wave whose PCM data has been filled in
+	 */
+	void Register(UImportedSoundWave* SoundWave);
+
+	/**
+	 * Stop tracking the PCM data of the sound wave
+	 *
+	 * @param SoundWave The sound wave to stop tracking
+	 */
+	void Unregister(UImportedSoundWave* SoundWave);
+
+	/**
+	 * Evict the PCM data of the least recently played sound waves until the total size of the resident PCM data fits the budget
+	 * Sound waves that are playing or were not imported from encoded audio data are never evicted
+	 */
+	void EnforceBudget();
+
+	/**
+	 * Get the memory budget, in bytes. Zero means there is no budget
+	 */
+	int64 GetBudget() const;
+
+	/**
+	 * Check whether a memory budget is set. The encoded audio data of imported sound waves is retained for re-decoding only while it is set
+	 */
+	bool IsBudgetEnabled() const;
+
+	/**
+	 * Get the total size of the resident PCM data of all tracked sound waves, in bytes. PCM data shared between sound waves (e.g. slices) is counted once
+	 */
+	int64 GetResidentSize() const;
+
+private:
+	/** Tracked sound waves */
+	TArray<TWeakObjectPtr<UImportedSoundWave>> SoundWaves;
+};
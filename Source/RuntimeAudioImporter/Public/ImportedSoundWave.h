@@ -3,6 +3,8 @@
 #pragma once
 
 #include "RuntimeAudioImporterTypes.h"
+#include "PCMRingBuffer.h"
+#include "Containers/Queue.h"
 #include "Sound/SoundWaveProcedural.h"
 #include "ImportedSoundWave.generated.h"
 
@@ -20,6 +22,36 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnGeneratePCMDataNative, const TArray<float
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGeneratePCMData, const TArray<float>&, PCMData);
 
 
+/** Playback command type */
+enum class EPlaybackCommandType : uint8
+{
+	/** Continue playing from the specified frame */
+	Seek,
+
+	/** Start looping the specified region */
+	SetLoopRegion,
+
+	/** Stop looping */
+	ClearLoopRegion
+};
+
+/** Playback command submitted from any thread and applied by the audio render thread at the start of the next generated block */
+struct FPlaybackCommand
+{
+	/** Command type */
+	EPlaybackCommandType Type;
+
+	/** Frame to seek to, or the first frame of the loop region */
+	uint32 StartFrame;
+
+	/** Frame after the last frame of the loop region */
+	uint32 EndFrame;
+
+	/** Number of frames to crossfade the end of the loop region into its start */
+	uint32 NumOfCrossfadeFrames;
+};
+
+
 /**
  * The main sound wave class used to play imported audio from the Runtime Audio Importer
  */
@@ -30,14 +62,61 @@ class RUNTIMEAUDIOIMPORTER_API UImportedSoundWave : public USoundWaveProcedural
 public:
 	//~ Begin USoundWave Interface
 	virtual void BeginDestroy() override;
+	virtual void OnBeginGenerate() override;
+	virtual void OnEndGenerate() override;
 	//~ End USoundWave Interface
 
 	/**
 	 * Release sound wave data. It is currently recommended to call manually when the sound wave is not needed, as the garbage collector does not correctly destroy the sound wave in some cases
+	 * Can be called while the sound wave is playing, in which case the playback finishes and the PCM data is freed once the audio render thread no longer reads it. Game thread only
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Miscellaneous")
 	void ReleaseMemory();
 
+	/**
+	 * Check whether the PCM data is in memory. It is not after being evicted by the memory manager, until it is re-decoded on the next play
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Miscellaneous")
+	bool IsPCMDataResident() const;
+
+	/**
+	 * Check whether the PCM data can be evicted: it is in memory, can be re-decoded, is not being played and is not shared with other sound waves (e.g. slices), so that evicting it frees the memory. Game thread only
+	 */
+	bool CanEvictPCMData() const;
+
+	/**
+	 * Evict the PCM data to save memory. It is freed on a background thread and re-decoded from the retained encoded audio data the next time the sound wave is played. Game thread only
+	 *
+	 * @return Size of the freed memory, in bytes. Zero if the PCM data could not be evicted
+	 */
+	int64 EvictPCMData();
+
+	/**
+	 * Re-decode the evicted PCM data from the retained encoded audio data in the background. Does nothing if the PCM data is resident or already being re-decoded. Can be called from any thread
+	 */
+	void ReloadPCMData();
+
+	/**
+	 * Get the time the sound wave was last played or had its PCM data filled in, in CPU cycles
+	 */
+	uint64 GetLastPlaybackCycles() const;
+
+	/**
+	 * Mark the sound wave as just used, so that the memory manager evicts it after the sound waves used before. Called when the PCM data is filled in, so that a newly imported sound wave is not evicted before it is played
+	 */
+	void MarkAsUsed();
+
+	/**
+	 * Create a sound wave playing a sub-range of this sound wave, e.g. to cut a long recording into clips. The PCM data is shared, not copied
+	 * The data precomputed during import (e.g. spectrogram) refers to the whole sound wave and is not carried over
+	 *
+	 * @param StartTime Start of the sub-range, in seconds
+	 * @param EndTime End of the sub-range, in seconds. A negative value means the end of the sound wave
+	 * @return The created sound wave, or nullptr if the sub-range is invalid
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Main")
+	UImportedSoundWave* CreateSlice(float StartTime, float EndTime = -1.f);
+
 	/**
 	 * Rewind the sound for the specified time
 	 *
@@ -49,12 +128,57 @@ public:
 
 	/**
 	 * Change the current number of frames. Usually used to rewind the sound
+	 * Can be called from any thread. The change is applied sample-accurately at the start of the next generated block
 	 *
 	 * @param NumOfFrames The new number of frames from which to continue playing sound
 	 * @return Whether the frames were changed or not
 	 */
 	bool ChangeCurrentFrameCount(const uint32 NumOfFrames);
 
+	/**
+	 * Get the current number of processed frames. A pending seek is reported as soon as it is submitted
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Info")
+	int32 GetCurrentNumOfFrames() const;
+
+	/**
+	 * Loop a region of the sound wave. The loop is applied sample-accurately at the start of the next generated block, without any game thread work during playback
+	 * Playback positioned after the end of the region plays through to the end of the sound wave
+	 *
+	 * @param StartTime Start of the loop region, in seconds
+	 * @param EndTime End of the loop region, in seconds. A negative value means the end of the sound wave
+	 * @param CrossfadeDuration Duration of the crossfade from the end of the region into its start, in seconds. Limited by the region length and by the time before the region start
+	 * @return Whether the loop region was set or not
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Main")
+	bool SetLoopRegion(float StartTime, float EndTime = -1.f, float CrossfadeDuration = 0.f);
+
+	/**
+	 * Loop a region of the sound wave, in frames
+	 *
+	 * @param StartFrame First frame of the loop region
+	 * @param EndFrame Frame after the last frame of the loop region
+	 * @param NumOfCrossfadeFrames Number of frames to crossfade the end of the region into its start
+	 * @return Whether the loop region was set or not
+	 */
+	bool SetLoopRegionFrames(uint32 StartFrame, uint32 EndFrame, uint32 NumOfCrossfadeFrames = 0);
+
+	/**
+	 * Stop looping. Playback continues to the end of the sound wave
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Main")
+	void ClearLoopRegion();
+
+	/**
+	 * Get the loop region, e.g. the one embedded in the imported WAV audio data
+	 *
+	 * @param StartTime Start of the loop region, in seconds
+	 * @param EndTime End of the loop region, in seconds
+	 * @return Whether a loop region is set or not
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Info")
+	bool GetLoopRegion(float& StartTime, float& EndTime) const;
+
 	/**
 	 * Get the current sound wave playback time, in seconds
 	 */
@@ -110,9 +234,174 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Imported Sound Wave|Delegates")
 	FOnGeneratePCMData OnGeneratePCMData;
 
+	/**
+	 * Enable the PCM tap. While enabled, generated PCM data is written to a lock-free ring buffer that can be drained from any thread at its own cadence
+	 * Unlike the OnGeneratePCMData delegates, this does not schedule any game thread tasks during playback
+	 *
+	 * @param BufferDuration Duration of PCM data the tap can hold, in seconds. Data that does not fit is dropped until the tap is read. Only used on the first call, which allocates the buffer
+	 * @return Whether the tap was enabled or not
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Analysis")
+	bool EnablePCMTap(float BufferDuration = 1.f);
+
+	/**
+	 * Stop writing generated PCM data to the tap. Data that has already been written can still be read
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Analysis")
+	void DisablePCMTap();
+
+	/**
+	 * Read interleaved PCM frames from the tap. There must be only one reader at a time
+	 *
+	 * @param PCMData Read interleaved 32-bit float PCM data
+	 * @param MaxNumOfFrames Maximum number of frames to read
+	 * @return Number of read frames
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Analysis")
+	int32 ReadPCMTap(TArray<float>& PCMData, int32 MaxNumOfFrames = 4096);
+
+	/**
+	 * Read interleaved PCM frames from the tap into caller-provided memory. There must be only one reader at a time
+	 *
+	 * @param OutPCMData Pointer to the memory with room for at least MaxNumOfFrames * NumChannels samples
+	 * @param MaxNumOfFrames Maximum number of frames to read
+	 * @return Number of read frames
+	 */
+	int32 ReadPCMTapToBuffer(float* OutPCMData, int32 MaxNumOfFrames);
+
+	/**
+	 * Get the number of frames available for reading from the PCM tap
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Analysis")
+	int32 GetPCMTapNumOfFrames() const;
+
+	/**
+	 * Get the precomputed spectrum closest to the specified time. The spectrogram must be generated during import
+	 *
+	 * @param Time Time in seconds
+	 * @param Magnitudes Linear magnitudes of the frequency bins, from 0 Hz up to half of the sample rate
+	 * @return Whether the spectrum was retrieved or not
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Analysis")
+	bool GetSpectrumAtTime(float Time, TArray<float>& Magnitudes) const;
+
+	/**
+	 * Get the precomputed spectrum closest to the current playback time. The spectrogram must be generated during import
+	 *
+	 * @param Magnitudes Linear magnitudes of the frequency bins, from 0 Hz up to half of the sample rate
+	 * @return Whether the spectrum was retrieved or not
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Analysis")
+	bool GetSpectrumAtPlaybackTime(TArray<float>& Magnitudes) const;
+
+	/**
+	 * Get evenly spaced waveform peaks of a single channel over a time range, e.g. one peak per horizontal pixel of a waveform widget. The cost depends only on the number of peaks, not on the length of the range
+	 * The waveform peaks must be generated during import
+	 *
+	 * @param ChannelIndex Index of the channel
+	 * @param StartTime Start of the time range, in seconds
+	 * @param EndTime End of the time range, in seconds. A negative value means the end of the sound wave
+	 * @param NumOfPeaks Number of peaks to split the time range into
+	 * @param Peaks The resulting minimum, maximum and RMS values
+	 * @return Whether the peaks were retrieved or not
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Analysis")
+	bool GetWaveformPeaks(int32 ChannelIndex, float StartTime, float EndTime, int32 NumOfPeaks, TArray<FWaveformPeak>& Peaks) const;
+
+	/**
+	 * Get the loudness measured during import. The loudness must be analyzed during import
+	 *
+	 * @param OutLoudnessInfo The measured loudness
+	 * @return Whether the loudness was retrieved or not
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Imported Sound Wave|Analysis")
+	bool GetLoudnessInfo(FLoudnessInfo& OutLoudnessInfo) const;
+
 private:
-	/** Bool to control the behaviour of the OnAudioPlaybackFinished delegate */
-	bool PlaybackFinishedBroadcast = false;
+	/**
+	 * Free the PCM data whose release is pending, unless a PCM generation call is reading it. In that case the last such call retries once it is done. Game thread only
+	 */
+	void TryReleasePCMData();
+
+	/**
+	 * Apply the playback commands submitted since the last generated block. Audio render thread only
+	 */
+	void ApplyPlaybackCommands();
+
+	/**
+	 * Check whether playback at the specified frame follows the loop region. Audio render thread only
+	 */
+	bool IsLoopingAt(uint32 Frame) const;
+
+	/**
+	 * Copy frames of the playback timeline starting at the specified frame, wrapping around the loop region. Audio render thread only
+	 *
+	 * @param StartFrame First frame to copy
+	 * @param NumOfFrames Number of frames to copy. Unless looping, the range must lie within the PCM data
+	 * @param OutData Pointer to the memory with room for at least NumOfFrames * NumChannels samples
+	 * @return Frame following the last copied frame
+	 */
+	uint32 GenerateFrames(uint32 StartFrame, uint32 NumOfFrames, float* OutData) const;
+
+	/**
+	 * Crossfade the copied frames lying before the loop region end with the frames leading into the loop region start. Audio render thread only
+	 *
+	 * @param StartFrame First copied frame
+	 * @param NumOfFrames Number of copied frames. The range must lie within the loop region
+	 * @param OutData Pointer to the copied frames
+	 */
+	void MixLoopCrossfade(uint32 StartFrame, uint32 NumOfFrames, float* OutData) const;
+
+	/** Playback commands waiting to be applied by the audio render thread */
+	TQueue<FPlaybackCommand, EQueueMode::Mpsc> PlaybackCommands;
+
+	/** The current number of processed frames. Written by the audio render thread only */
+	TAtomic<uint32> PlaybackNumOfFrames{0};
+
+	/** Number of submitted seek commands that have not been applied yet */
+	TAtomic<int32> NumOfPendingSeeks{0};
+
+	/** Target frame of the most recently submitted seek command */
+	TAtomic<uint32> PendingSeekNumOfFrames{0};
+
+	/** Whether the end of the PCM data has been reached. Controls the behaviour of the OnAudioPlaybackFinished delegate */
+	TAtomic<bool> bPlaybackFinished{false};
+
+	/** Loop region applied by the audio render thread. Audio render thread only */
+	FLoopRegionStruct ActiveLoopRegion{0, 0};
+
+	/** Number of crossfaded frames at the end of the applied loop region. Audio render thread only */
+	uint32 NumOfActiveLoopCrossfadeFrames = 0;
+
+	/** Whether the applied loop region is used. Audio render thread only */
+	bool bLoopRegionActive = false;
+
+	/** Most recently submitted loop region. Game thread only */
+	TOptional<FLoopRegionStruct> LoopRegion;
+
+	/** Ring buffer receiving the generated PCM data. Allocated once when the tap is first enabled */
+	TUniquePtr<FPCMRingBuffer> PCMTapBuffer;
+
+	/** Whether the generated PCM data should be written to the tap */
+	TAtomic<bool> bPCMTapEnabled{false};
+
+	/** Whether the PCM data is in memory. The audio render thread does not touch the PCM data while it is not */
+	TAtomic<bool> bPCMDataResident{true};
+
+	/** Number of active sound generators plus the number of PCM generation calls in progress. The PCM data is never evicted while it is above zero */
+	TAtomic<int32> NumOfActiveGenerators{0};
+
+	/** Number of PCM generation calls in progress. The PCM data is never released while it is above zero */
+	TAtomic<int32> NumOfGenerateCalls{0};
+
+	/** Whether the PCM data is waiting to be released once no PCM generation call reads it */
+	TAtomic<bool> bPCMDataReleasePending{false};
+
+	/** Whether the evicted PCM data is being re-decoded */
+	TAtomic<bool> bPCMDataReloadPending{false};
+
+	/** Time the sound wave was last played or had its PCM data filled in, in CPU cycles */
+	TAtomic<uint64> LastPlaybackCycles{0};
 
 public:
 	//~ Begin UProceduralSoundWave Interface
@@ -135,10 +424,26 @@ public:
 
 	//~ End UProceduralSoundWave Interface
 
-	/** The current number of processed frames */
-	UPROPERTY(BlueprintReadOnly, Category = "Imported Sound Wave|Info")
+	/** The current number of processed frames. Kept for existing Blueprints, which read it through GetCurrentNumOfFrames. The field itself is not updated, so use GetCurrentNumOfFrames in C++ */
+	UPROPERTY(BlueprintGetter = GetCurrentNumOfFrames, Category = "Imported Sound Wave|Info", meta = (DeprecatedProperty, DeprecationMessage = "Use GetCurrentNumOfFrames instead"))
 	int32 CurrentNumOfFrames = 0;
 
+	/** Linear gain applied while generating the PCM data. Set to the loudness normalization gain if it is applied on playback */
+	UPROPERTY(BlueprintReadWrite, Category = "Imported Sound Wave|Main")
+	float PlaybackGain = 1.f;
+
 	/** Contains PCM data for sound wave playback */
 	FPCMStruct PCMBufferInfo;
+
+	/** Spectrogram precomputed during import. Invalid unless requested in the import settings */
+	TSharedPtr<const FSpectrogramStruct, ESPMode::ThreadSafe> SpectrogramInfo;
+
+	/** Waveform peak pyramid precomputed during import. Invalid unless requested in the import settings */
+	TSharedPtr<const FWaveformPeaksStruct, ESPMode::ThreadSafe> WaveformPeaksInfo;
+
+	/** Loudness measured during import. Unset unless requested in the import settings */
+	TOptional<FLoudnessInfo> LoudnessInfo;
+
+	/** Encoded audio data the PCM data was decoded from. Retained only if a memory budget was set during import, so that the PCM data can be evicted and re-decoded */
+	TSharedPtr<const FEncodedAudioSourceStruct, ESPMode::ThreadSafe> EncodedAudioSource;
 };
@@ -0,0 +1,72 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+
+/**
+ * Lock-free single-producer single-consumer ring buffer of 32-bit float PCM samples
+ * The producer and the consumer may run on different threads, but there must be only one of each at a time
+ */
+class RUNTIMEAUDIOIMPORTER_API FPCMRingBuffer
+{
+public:
+	/**
+	 * Create a ring buffer
+	 *
+	 * @param InCapacity Minimum number of samples the buffer can hold. Rounded up to a power of two
+	 */
+	explicit FPCMRingBuffer(int32 InCapacity);
+
+	/**
+	 * Write samples to the buffer. Producer only
+	 *
+	 * @param Data Pointer to the samples to write
+	 * @param NumOfSamples Number of samples to write
+	 * @param Granularity Samples are written in multiples of this value (e.g. the number of channels) so that frames are never split
+	 * @return Number of written samples. Samples that do not fit are dropped
+	 */
+	int32 Push(const float* Data, int32 NumOfSamples, int32 Granularity = 1);
+
+	/**
+	 * Read samples from the buffer. Consumer only
+	 *
+	 * @param OutData Pointer to the memory to read the samples to
+	 * @param MaxNumOfSamples Maximum number of samples to read
+	 * @param Granularity Samples are read in multiples of this value (e.g. the number of channels) so that frames are never split
+	 * @return Number of read samples
+	 */
+	int32 Pop(float* OutData, int32 MaxNumOfSamples, int32 Granularity = 1);
+
+	/**
+	 * Get the number of samples available for reading
+	 */
+	int32 Num() const;
+
+	/**
+	 * Get the maximum number of samples the buffer can hold
+	 */
+	int32 GetCapacity() const;
+
+	/**
+	 * Get the number of samples dropped by the producer because the buffer was full
+	 */
+	uint64 GetNumOfDroppedSamples() const;
+
+private:
+	/** Sample storage */
+	TArray<float> Buffer;
+
+	/** Capacity minus one, used to wrap the indices */
+	uint64 Mask;
+
+	/** Total number of samples read. Written by the consumer only */
+	TAtomic<uint64> ReadIndex;
+
+	/** Total number of samples written. Written by the producer only */
+	TAtomic<uint64> WriteIndex;
+
+	/** Total number of samples that did not fit into the buffer */
+	TAtomic<uint64> NumOfDroppedSamples;
+};
@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "RuntimeAudioImporterTypes.h"
+#include "Serialization/BulkData.h"
+#if WITH_EDITOR && ENGINE_MAJOR_VERSION >= 5
+#include "UObject/ObjectSaveContext.h"
+#endif
 #include "PreImportedSoundAsset.generated.h"
 
 /**
@@ -15,14 +19,63 @@ class RUNTIMEAUDIOIMPORTER_API UPreImportedSoundAsset : public UObject
 	GENERATED_BODY()
 public:
 
-	/** Audio data array */
+	/** Audio data of packages saved before it was moved to the bulk data. Moved to the bulk data on load */
 	UPROPERTY()
-	TArray<uint8> AudioDataArray;
+	TArray<uint8> AudioDataArray_DEPRECATED;
 
 	/** Audio data format */
 	UPROPERTY(Category = "Info", VisibleAnywhere, Meta = (DisplayName = "Audio format"))
 	EAudioFormat AudioFormat = EAudioFormat::Mp3;
 
+	/** Format of the audio data in cooked packages. Pre-decoded audio data is imported without format detection and decoding, at the cost of a larger package */
+	UPROPERTY(Category = "Cooking", EditAnywhere, Meta = (DisplayName = "Cook format"))
+	EPreImportedSoundCookFormat CookFormat = EPreImportedSoundCookFormat::Original;
+
+	/** Number of channels of the pre-decoded audio data */
+	UPROPERTY()
+	int32 PreDecodedNumOfChannels = 0;
+
+	/** Sample rate of the pre-decoded audio data */
+	UPROPERTY()
+	int32 PreDecodedSampleRate = 0;
+
+	/** Original audio data. Not loaded with the package, but streamed on demand */
+	FByteBulkData AudioBulkData;
+
+	/** Audio data pre-decoded to the cook format. Only filled while cooking, cooked packages contain it instead of the original audio data */
+	FByteBulkData PreDecodedBulkData;
+
+	/**
+	 * Check whether the asset contains pre-decoded audio data
+	 */
+	bool HasPreDecodedAudioData() const;
+
+	/**
+	 * Replace the original audio data
+	 *
+	 * @param AudioData Original audio data (e.g. the content of an MP3 file)
+	 */
+	void SetAudioData(const TArray<uint8>& AudioData);
+
+	/**
+	 * Load the audio data to import asynchronously: the pre-decoded audio data if present, or the original audio data otherwise. The audio data is streamed right into the array passed to the callback
+	 *
+	 * @param OnLoaded Callback receiving the loaded audio data, which is empty if loading failed. Called on a background thread
+	 */
+	void LoadAudioDataAsync(TFunction<void(TArray<uint8> AudioData)> OnLoaded) const;
+
+	//~ Begin UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+#if ENGINE_MAJOR_VERSION < 5
+	virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
+#else
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#endif
+#endif
+	//~ End UObject Interface
+
 	/** Information about the basic details of an audio file. Used only for convenience in the editor */
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(Category = "File Path", VisibleAnywhere, Meta = (DisplayName = "Source file path"))
@@ -36,5 +89,9 @@ public:
 
 	UPROPERTY(Category = "Info", VisibleAnywhere, Meta = (DisplayName = "Sample rate"))
 	int32 SampleRate;
+
+	/** Waveform overview drawn in the asset thumbnail. Contains the peaks of all channels, one channel after another */
+	UPROPERTY()
+	TArray<FWaveformPeak> ThumbnailPeaks;
 #endif
 };
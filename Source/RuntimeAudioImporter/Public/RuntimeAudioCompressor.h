@@ -43,20 +43,22 @@ public:
 	 * @param ImportedSoundWaveRef Reference to the imported sound wave
 	 * @param CompressedSoundWaveInfo Basic information for filling a sound wave (partially taken from the standard Sound Wave asset)
 	 * @param Quality The quality of the encoded audio data. From 0 to 100
-	 * @param bFillCompressedBuffer Whether to fill the compressed buffer. It is supposed to be true to reduce memory
 	 * @param bFillPCMBuffer Whether to fill PCM buffer. Mainly used for in-engine previews. It is recommended not to enable to save memory
 	 * @param bFillRAWWaveBuffer Whether to fill RAW Wave buffer. It is recommended not to enable to save memory
+	 * @param bFillCompressedBuffer Whether to fill the compressed buffer, decoded by the engine in real time during playback. It is supposed to be true to reduce memory. Requires a platform that decodes the chosen format at runtime
+	 * @param CompressedFormat Format of the compressed buffer. ADPCM takes about four times less memory than 16-bit PCM and is much cheaper to decode than Ogg Vorbis, but the platform's runtime audio format must be ADPCM
 	 *
 	 * @note Some unique features will be missing, such as the "OnGeneratePCMData" delegate. But at the same time, you do not need to manually rewind the sound wave through "RewindPlaybackTime", but use traditional methods
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Runtime Audio Importer|Utilities")
-	void CompressSoundWave(UImportedSoundWave* ImportedSoundWaveRef, FCompressedSoundWaveInfo CompressedSoundWaveInfo, uint8 Quality, /*bool bFillCompressedBuffer,*/ bool bFillPCMBuffer, bool bFillRAWWaveBuffer);
+	void CompressSoundWave(UImportedSoundWave* ImportedSoundWaveRef, FCompressedSoundWaveInfo CompressedSoundWaveInfo, uint8 Quality, bool bFillPCMBuffer, bool bFillRAWWaveBuffer, bool bFillCompressedBuffer = false, ECompressedSoundWaveFormat CompressedFormat = ECompressedSoundWaveFormat::OggVorbis);
 
 private:
 	/**
-	 * Audio compression finished callback
+	 * Audio compression finished callback. The rooted sound wave is removed from the root on the game thread whether or not the compression succeeded
 	 * 
-	 * @param SoundWaveRef Reference to the compressed sound wave
+	 * @param SoundWaveRef Reference to the compressed sound wave, or nullptr if it was never created or rooted
+	 * @param bSuccess Whether the compression was successful or not. The sound wave is not broadcast if it was not
 	 */
-	void BroadcastResult(USoundWave* SoundWaveRef);
+	void BroadcastResult(USoundWave* SoundWaveRef, bool bSuccess);
 };
@@ -7,9 +7,52 @@
 #include "Logging/LogCategory.h"
 #include "Logging/LogMacros.h"
 #include "Logging/LogVerbosity.h"
+#include "Templates/Function.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogRuntimeAudioImporter, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("Runtime Audio Importer"), STATGROUP_RuntimeAudioImporter, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Read"), STAT_RuntimeAudioImporter_Read, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Probe"), STAT_RuntimeAudioImporter_Probe, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Mp3"), STAT_RuntimeAudioImporter_DecodeMp3, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Wav"), STAT_RuntimeAudioImporter_DecodeWav, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Flac"), STAT_RuntimeAudioImporter_DecodeFlac, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Vorbis"), STAT_RuntimeAudioImporter_DecodeVorbis, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Transcode RAW"), STAT_RuntimeAudioImporter_TranscodeRAW, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Process"), STAT_RuntimeAudioImporter_Process, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Encode"), STAT_RuntimeAudioImporter_Encode, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Finalize"), STAT_RuntimeAudioImporter_Finalize, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnGeneratePCMAudio"), STAT_RuntimeAudioImporter_GeneratePCMAudio, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live PCM Data"), STAT_RuntimeAudioImporter_LivePCMData, STATGROUP_RuntimeAudioImporter, RUNTIMEAUDIOIMPORTER_API);
+
+/** Trace channel of the import and playback spans. Enable with "-trace=cpu,RuntimeAudioImporter" */
+UE_TRACE_CHANNEL_EXTERN(RuntimeAudioImporterChannel, RUNTIMEAUDIOIMPORTER_API);
+
+/** Trace a scope on the RuntimeAudioImporter channel */
+#define RUNTIMEAUDIOIMPORTER_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, RuntimeAudioImporterChannel)
+
+/** Trace a scope on the RuntimeAudioImporter channel, tagged with the size of the processed data rounded up to a power of two. The tagged name is only formatted while the channels are enabled */
+#define RUNTIMEAUDIOIMPORTER_TRACE_SCOPE_SIZED(Name, Size) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(UE_TRACE_CHANNELEXPR_IS_ENABLED(RuntimeAudioImporterChannel | CpuChannel) ? *RuntimeAudioImporter_Trace::GetSizedScopeName(TEXT(Name), Size) : TEXT(Name), RuntimeAudioImporterChannel)
+
+namespace RuntimeAudioImporter_Trace
+{
+	/**
+	 * Get the name of a trace scope tagged with the size of the processed data. The size is rounded up to a power of two, which keeps the number of distinct scope names small
+	 */
+	inline FString GetSizedScopeName(const TCHAR* Name, int64 Size)
+	{
+		const uint64 RoundedSize = FMath::RoundUpToPowerOfTwo64(static_cast<uint64>(FMath::Max<int64>(Size, 1)));
+
+		return RoundedSize >= 1024 * 1024
+			       ? FString::Printf(TEXT("%s (up to %llu MB)"), Name, RoundedSize / (1024 * 1024))
+			       : FString::Printf(TEXT("%s (up to %llu KB)"), Name, FMath::DivideAndRoundUp<uint64>(RoundedSize, 1024));
+	}
+}
+
 namespace RuntimeAudioImporter_TranscoderLogs
 {
 	static void PrintLog(const FString& LogString)
@@ -26,4 +69,48 @@ namespace RuntimeAudioImporter_TranscoderLogs
 	{
 		UE_LOG(LogRuntimeAudioImporter, Error, TEXT("%s"), *ErrorString);
 	}
-}
\ No newline at end of file
+}
+
+/** Callback receiving the fraction of the audio data decoded so far, from 0 to 1. Called on the decoding thread */
+using FOnDecodingProgress = TFunction<void(float)>;
+
+namespace RuntimeAudioImporter_Decoding
+{
+	/** Number of frames decoded between progress reports */
+	constexpr uint64 NumOfFramesPerChunk = 65536;
+
+	/**
+	 * Read interleaved 32-bit float PCM frames in chunks, reporting the progress after each one
+	 *
+	 * @param TotalNumOfFrames Number of frames to read
+	 * @param NumOfChannels Number of channels
+	 * @param OutData Pointer to the memory with room for at least TotalNumOfFrames * NumOfChannels samples
+	 * @param OnProgress Progress callback. May be unset
+	 * @param ReadFrames Function reading the specified number of frames to the specified memory and returning the number of read frames
+	 * @return Number of read frames
+	 */
+	template <typename ReadFramesType>
+	uint64 ReadFramesInChunks(uint64 TotalNumOfFrames, uint32 NumOfChannels, float* OutData, const FOnDecodingProgress& OnProgress, ReadFramesType ReadFrames)
+	{
+		uint64 NumOfReadFrames = 0;
+
+		while (NumOfReadFrames < TotalNumOfFrames)
+		{
+			const uint64 NumOfChunkFrames = ReadFrames(FMath::Min(NumOfFramesPerChunk, TotalNumOfFrames - NumOfReadFrames), OutData + NumOfReadFrames * NumOfChannels);
+
+			if (NumOfChunkFrames == 0)
+			{
+				break;
+			}
+
+			NumOfReadFrames += NumOfChunkFrames;
+
+			if (OnProgress)
+			{
+				OnProgress(static_cast<float>(NumOfReadFrames) / TotalNumOfFrames);
+			}
+		}
+
+		return NumOfReadFrames;
+	}
+}
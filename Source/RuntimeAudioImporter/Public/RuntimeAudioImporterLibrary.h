@@ -4,6 +4,8 @@
 
 #include "ImportedSoundWave.h"
 #include "RuntimeAudioImporterTypes.h"
+#include "RuntimeAudioImporterDefines.h"
+#include "Templates/Atomic.h"
 #include "RuntimeAudioImporterLibrary.generated.h"
 
 /** Static delegate broadcast to get the audio importer progress */
@@ -19,6 +21,12 @@ DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnAudioImporterResultNative, class URunt
 /** Dynamic delegate broadcast to get the audio importer result */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAudioImporterResult, class URuntimeAudioImporterLibrary*, RuntimeAudioImporterObjectRef, UImportedSoundWave*, SoundWaveRef, ETranscodingStatus, Status);
 
+/** Static delegate broadcast to get the audio importer result along with the timings of the import */
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnAudioImporterResultWithTimingReportNative, class URuntimeAudioImporterLibrary* RuntimeAudioImporterObjectRef, UImportedSoundWave* SoundWaveRef, ETranscodingStatus Status, const FImportTimingReport& TimingReport);
+
+/** Dynamic delegate broadcast to get the audio importer result along with the timings of the import */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnAudioImporterResultWithTimingReport, class URuntimeAudioImporterLibrary*, RuntimeAudioImporterObjectRef, UImportedSoundWave*, SoundWaveRef, ETranscodingStatus, Status, const FImportTimingReport&, TimingReport);
+
 /** Forward declaration of the UPreImportedSoundAsset class */
 class UPreImportedSoundAsset;
 
@@ -46,6 +54,17 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Runtime Audio Importer|Delegates")
 	FOnAudioImporterResult OnResult;
 
+	/** Bind to know when audio import is complete (even if it fails) along with the timings of the import. Recommended for C++ only */
+	FOnAudioImporterResultWithTimingReportNative OnResultWithTimingReportNative;
+	
+	/** Bind to know when audio import is complete (even if it fails) along with the timings of the import. Recommended for Blueprints only */
+	UPROPERTY(BlueprintAssignable, Category = "Runtime Audio Importer|Delegates")
+	FOnAudioImporterResultWithTimingReport OnResultWithTimingReport;
+
+	/** Settings applied to the decoded audio data during import (e.g. resampling). Captured when the import starts */
+	UPROPERTY(BlueprintReadWrite, Category = "Runtime Audio Importer|Settings")
+	FAudioImportSettings ImportSettings;
+
 	/**
 	 * Instantiates a RuntimeAudioImporter object
 	 *
@@ -174,9 +193,30 @@ public:
 	 *
 	 * @param EncodedAudioInfo Encoded audio data
 	 * @param DecodedAudioInfo Decoded audio data
+	 * @param OnDecodingProgress Callback receiving the fraction of the audio data decoded so far. May be unset
 	 * @return Whether the decoding was successful or not
 	 */
-	static bool DecodeAudioData(FEncodedAudioStruct& EncodedAudioInfo, FDecodedAudioStruct& DecodedAudioInfo);
+	static bool DecodeAudioData(FEncodedAudioStruct& EncodedAudioInfo, FDecodedAudioStruct& DecodedAudioInfo, const FOnDecodingProgress& OnDecodingProgress = nullptr);
+
+	/**
+	 * Get the basic information (e.g. duration, number of channels, etc) of compressed audio data from its headers, without decoding it
+	 *
+	 * @param AudioData Pointer to in-memory audio data
+	 * @param AudioDataSize Size of in-memory audio data
+	 * @param AudioFormat Format of the audio data. Determined and updated if Auto
+	 * @param BasicInfo The basic information of the audio data
+	 * @return Whether the information was retrieved successfully or not
+	 */
+	static bool GetAudioInfo(const uint8* AudioData, int32 AudioDataSize, EAudioFormat& AudioFormat, FSoundWaveBasicStruct& BasicInfo);
+
+	/**
+	 * Process decoded audio data according to the import settings (e.g. convert to the target sample rate)
+	 *
+	 * @param DecodedAudioInfo Decoded audio data to be processed in place
+	 * @param ImportSettings Settings describing the required processing
+	 * @return Whether the processing was successful or not
+	 */
+	static bool ProcessDecodedAudioData(FDecodedAudioStruct& DecodedAudioInfo, const FAudioImportSettings& ImportSettings);
 
 	/**
 	 * Encode uncompressed audio data to compressed
@@ -210,8 +250,9 @@ public:
 	 * Create Imported Sound Wave and finish importing.
 	 *
 	 * @param DecodedAudioInfo Decoded audio data
+	 * @param EncodedAudioSource Encoded audio data the decoded audio data was decoded from, retained to re-decode the PCM data after eviction. May be invalid
 	 */
-	void ImportAudioFromDecodedInfo(const FDecodedAudioStruct& DecodedAudioInfo);
+	void ImportAudioFromDecodedInfo(const FDecodedAudioStruct& DecodedAudioInfo, const TSharedPtr<const FEncodedAudioSourceStruct, ESPMode::ThreadSafe>& EncodedAudioSource = nullptr);
 
 	/**
 	 * Define SoundWave object reference
@@ -231,29 +272,117 @@ public:
 	static void FillSoundWaveBasicInfo(UImportedSoundWave* SoundWaveRef, const FDecodedAudioStruct& DecodedAudioInfo);
 
 	/**
-	 * Fill SoundWave PCM data buffer
+	 * Fill SoundWave PCM data buffer. The buffer is shared with the decoded audio data, not copied
 	 *
 	 * @param SoundWaveRef Reference to the imported sound wave
 	 * @param DecodedAudioInfo Decoded audio data
 	 */
 	static void FillPCMData(UImportedSoundWave* SoundWaveRef, const FDecodedAudioStruct& DecodedAudioInfo);
 
+	/**
+	 * Fill SoundWave data precomputed during import (e.g. spectrogram)
+	 *
+	 * @param SoundWaveRef Reference to the imported sound wave
+	 * @param DecodedAudioInfo Decoded audio data
+	 */
+	static void FillAnalysisData(UImportedSoundWave* SoundWaveRef, const FDecodedAudioStruct& DecodedAudioInfo);
+
+	/**
+	 * Generate an overview of the whole waveform, e.g. for asset thumbnails
+	 *
+	 * @param DecodedAudioInfo Decoded audio data
+	 * @param NumOfPeaksPerChannel Number of peaks to split each channel into
+	 * @param Peaks The resulting peaks of all channels, one channel after another
+	 * @return Whether the generation was successful or not
+	 */
+	static bool GenerateWaveformThumbnailPeaks(const FDecodedAudioStruct& DecodedAudioInfo, int32 NumOfPeaksPerChannel, TArray<FWaveformPeak>& Peaks);
+
 protected:
 	/** Creates a new instance of the ImportedSoundWave class to use */
 	virtual UImportedSoundWave* CreateImportedSoundWave() const;
 
 	/**
-	 * Audio transcoding progress callback
+	 * Audio transcoding progress callback. Can be called from any thread. The delegates are broadcast with the latest percentage at most once per game tick
 	 * 
 	 * @param Percentage Percentage of importing completion (0-100%)
 	 */
 	void OnProgress_Internal(int32 Percentage);
 
+	/**
+	 * Broadcast the latest progress if it has changed since the last broadcast. Game thread only
+	 *
+	 * @return Whether the progress was broadcast or not
+	 */
+	bool BroadcastProgress_Internal();
+
+	/**
+	 * Ticker callback broadcasting the progress until it stops changing. Game thread only
+	 *
+	 * @return Whether the ticker should keep ticking or not
+	 */
+	bool TickProgress_Internal();
+
+	/**
+	 * Reset the progress when an import starts, so that the progress of a previous import is neither broadcast again nor mistaken for the new one
+	 */
+	void ResetProgress_Internal();
+
+	/**
+	 * Import audio from buffer, continuing the timing of the import
+	 *
+	 * @param AudioData Audio data array
+	 * @param Format Audio format
+	 * @param TimingReport Timings of the import stages completed so far
+	 */
+	void ImportAudioFromBuffer_Internal(TArray<uint8> AudioData, EAudioFormat Format, FImportTimingReport TimingReport);
+
+	/**
+	 * Import audio from RAW buffer, continuing the timing of the import
+	 *
+	 * @param RAWBuffer RAW audio buffer
+	 * @param Format RAW audio format
+	 * @param SampleRate The number of samples per second
+	 * @param NumOfChannels The number of channels (1 for mono, 2 for stereo, etc)
+	 * @param TimingReport Timings of the import stages completed so far
+	 */
+	void ImportAudioFromRAWBuffer_Internal(TArray<uint8> RAWBuffer, ERAWAudioFormat Format, int32 SampleRate, int32 NumOfChannels, FImportTimingReport TimingReport);
+
+	/**
+	 * Import audio from 32-bit float PCM data, continuing the timing of the import
+	 *
+	 * @param PCMData Pointer to memory location of the PCM data
+	 * @param PCMDataSize Memory size allocated for the PCM data
+	 * @param SampleRate The number of samples per second
+	 * @param NumOfChannels The number of channels (1 for mono, 2 for stereo, etc)
+	 * @param TimingReport Timings of the import stages completed so far
+	 */
+	void ImportAudioFromFloat32Buffer_Internal(uint8* PCMData, int32 PCMDataSize, int32 SampleRate, int32 NumOfChannels, FImportTimingReport TimingReport);
+
+	/**
+	 * Create Imported Sound Wave and finish importing, continuing the timing of the import
+	 *
+	 * @param DecodedAudioInfo Decoded audio data
+	 * @param EncodedAudioSource Encoded audio data the decoded audio data was decoded from, retained to re-decode the PCM data after eviction. May be invalid
+	 * @param TimingReport Timings of the import stages completed so far
+	 */
+	void ImportAudioFromDecodedInfo_Internal(const FDecodedAudioStruct& DecodedAudioInfo, const TSharedPtr<const FEncodedAudioSourceStruct, ESPMode::ThreadSafe>& EncodedAudioSource, FImportTimingReport TimingReport);
+
 	/**
 	 * Audio importing finished callback
 	 * 
 	 * @param SoundWaveRef Reference to the imported sound wave
 	 * @param Status Importing status
+	 * @param TimingReport Timings of the import stages completed so far. The total time is filled in here
 	 */
-	void OnResult_Internal(UImportedSoundWave* SoundWaveRef, ETranscodingStatus Status);
+	void OnResult_Internal(UImportedSoundWave* SoundWaveRef, ETranscodingStatus Status, FImportTimingReport TimingReport = FImportTimingReport());
+
+private:
+	/** The latest progress percentage. Written from any thread */
+	TAtomic<int32> ProgressPercentage{0};
+
+	/** Whether a progress ticker is scheduled. Ensures there is at most one pending game thread dispatch per importer */
+	TAtomic<bool> bProgressDispatchPending{false};
+
+	/** The last progress percentage broadcast to the delegates. Game thread only */
+	int32 LastBroadcastProgressPercentage = INDEX_NONE;
 };
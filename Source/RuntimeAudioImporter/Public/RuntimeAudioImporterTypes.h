@@ -30,7 +30,10 @@ enum class ETranscodingStatus : uint8
 	AudioDoesNotExist UMETA(DisplayName = "Audio does not exist"),
 
 	/** Load file to array error */
-	LoadFileToArrayError UMETA(DisplayName = "Load file to array error")
+	LoadFileToArrayError UMETA(DisplayName = "Load file to array error"),
+
+	/** Failed to process the decoded audio data (e.g. resampling) */
+	FailedToProcessAudioData UMETA(DisplayName = "Failed to process audio data")
 };
 
 /** Possible audio formats (extensions) */
@@ -55,6 +58,76 @@ enum class ERAWAudioFormat : uint8
 	Float32 UMETA(DisplayName = "32-bit float")
 };
 
+/** Possible quality levels of the import-time resampler */
+UENUM(BlueprintType, Category = "Runtime Audio Importer")
+enum class EAudioResamplingQuality : uint8
+{
+	/** Short filter, suitable for speech and sound effects */
+	Low UMETA(DisplayName = "Low"),
+
+	/** Balanced filter length and stopband attenuation */
+	Medium UMETA(DisplayName = "Medium"),
+
+	/** Long filter with a steep transition band, suitable for music */
+	High UMETA(DisplayName = "High")
+};
+
+/** Possible channel layout conversions applied during import */
+UENUM(BlueprintType, Category = "Runtime Audio Importer")
+enum class EChannelRemixMode : uint8
+{
+	/** Keep the original channels */
+	None UMETA(DisplayName = "None"),
+
+	/** Downmix all channels to a single channel */
+	DownmixToMono UMETA(DisplayName = "Downmix to mono"),
+
+	/** Downmix multichannel audio (e.g. 5.1 or 7.1) to two channels */
+	DownmixToStereo UMETA(DisplayName = "Downmix to stereo"),
+
+	/** Keep only one of the original channels */
+	ExtractChannel UMETA(DisplayName = "Extract single channel")
+};
+
+/** Possible ways of applying the loudness normalization gain */
+UENUM(BlueprintType, Category = "Runtime Audio Importer")
+enum class ELoudnessNormalization : uint8
+{
+	/** Only measure the loudness, without changing the audio */
+	None UMETA(DisplayName = "Analyze only"),
+
+	/** Apply the gain while generating the PCM data for playback. The audio data stays untouched */
+	ApplyOnPlayback UMETA(DisplayName = "Apply on playback"),
+
+	/** Multiply the audio data by the gain during import */
+	BakeIntoAudioData UMETA(DisplayName = "Bake into audio data")
+};
+
+/** Possible formats of the compressed buffer of the compressed sound wave */
+UENUM(BlueprintType, Category = "Runtime Audio Importer")
+enum class ECompressedSoundWaveFormat : uint8
+{
+	/** Ogg Vorbis. Smallest size, but the most expensive to decode */
+	OggVorbis UMETA(DisplayName = "Ogg Vorbis"),
+
+	/** 4-bit Microsoft ADPCM. About four times smaller than 16-bit PCM and very cheap to decode */
+	ADPCM UMETA(DisplayName = "ADPCM")
+};
+
+/** Possible formats of the audio data of the pre-imported sound asset in cooked packages */
+UENUM(BlueprintType, Category = "Runtime Audio Importer")
+enum class EPreImportedSoundCookFormat : uint8
+{
+	/** The original audio data. Smallest size, but decoded on every import */
+	Original UMETA(DisplayName = "Original"),
+
+	/** Pre-decoded signed 16-bit PCM. Imported without decoding, about half the size of 32-bit float */
+	Int16 UMETA(DisplayName = "Signed 16-bit PCM"),
+
+	/** Pre-decoded 32-bit float PCM. Imported without decoding or conversion, at the largest size */
+	Float32 UMETA(DisplayName = "32-bit float")
+};
+
 /** Basic SoundWave data. CPP use only. */
 struct FSoundWaveBasicStruct
 {
@@ -78,18 +151,181 @@ struct FSoundWaveBasicStruct
 	}
 };
 
+/** Run of silent frames which is not stored in the PCM data. CPP use only. */
+struct FPCMSilentSpan
+{
+	/** First frame of the span, in the playback timeline */
+	uint32 StartFrame;
+
+	/** Number of frames in the span */
+	uint32 NumOfFrames;
+
+	/** Index of the stored frame the span is inserted before */
+	uint32 StoredFrame;
+};
+
+/**
+ * Thread-safe reference-counted PCM memory. Copies and slices share the memory instead of duplicating it, so it must not be modified once shared. CPP use only.
+ */
+class FSharedPCMBuffer
+{
+public:
+	/** Base constructor */
+	FSharedPCMBuffer()
+		: ViewData(nullptr)
+	  , ViewSize(0)
+	{
+	}
+
+	/**
+	 * Take ownership of memory allocated with FMemory::Malloc
+	 *
+	 * @param InData Pointer to the memory
+	 * @param InSize Memory size, in bytes
+	 */
+	FSharedPCMBuffer(uint8* InData, int64 InSize)
+		: Allocation(MakeShared<FAllocation, ESPMode::ThreadSafe>(InData, InSize))
+	  , ViewData(InData)
+	  , ViewSize(InSize)
+	{
+	}
+
+	/**
+	 * Get the viewed memory
+	 */
+	TArrayView64<uint8> GetView() const
+	{
+		return TArrayView64<uint8>(ViewData, ViewSize);
+	}
+
+	/**
+	 * Get the identity of the shared memory, e.g. to count memory shared between buffers once. nullptr if there is no memory
+	 */
+	const void* GetAllocationId() const
+	{
+		return Allocation.Get();
+	}
+
+	/**
+	 * Get the size of the whole shared memory, which may be larger than the viewed memory, in bytes
+	 */
+	int64 GetAllocationSize() const
+	{
+		return Allocation.IsValid() ? Allocation->Size : 0;
+	}
+
+	/**
+	 * Check whether no other buffer refers to the memory, so that releasing this reference frees it
+	 */
+	bool IsUnique() const
+	{
+		return Allocation.IsValid() && Allocation.IsUnique();
+	}
+
+	/**
+	 * Create a buffer viewing a sub-range of this one. The memory is shared, not copied
+	 *
+	 * @param Offset Offset from the start of the viewed memory, in bytes
+	 * @param Size Size of the sub-range, in bytes
+	 * @return Buffer viewing the sub-range
+	 */
+	FSharedPCMBuffer Slice(int64 Offset, int64 Size) const
+	{
+		check(Offset >= 0 && Size >= 0 && Offset + Size <= ViewSize);
+
+		FSharedPCMBuffer SlicedBuffer{*this};
+		SlicedBuffer.ViewData += Offset;
+		SlicedBuffer.ViewSize = Size;
+
+		return SlicedBuffer;
+	}
+
+	/**
+	 * Copy the viewed memory if it is shared with other buffers, so that it can be modified in place
+	 */
+	void Detach()
+	{
+		if (Allocation.IsValid() && !Allocation.IsUnique())
+		{
+			*this = FSharedPCMBuffer(static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(ViewSize), ViewData, ViewSize)), ViewSize);
+		}
+	}
+
+	/**
+	 * Take the memory out of the buffer, e.g. to hand it over to the engine. Only possible if no other buffer refers to the memory and the view starts at its beginning
+	 *
+	 * @return Pointer to the memory allocated with FMemory::Malloc, or nullptr if the memory cannot be taken
+	 */
+	uint8* Release()
+	{
+		if (!Allocation.IsValid() || !Allocation.IsUnique() || Allocation->Data != ViewData)
+		{
+			return nullptr;
+		}
+
+		uint8* ReleasedData = Allocation->Data;
+		Allocation->Data = nullptr;
+		Empty();
+
+		return ReleasedData;
+	}
+
+	/**
+	 * Release this reference. The memory is freed once no other buffer refers to it
+	 */
+	void Empty()
+	{
+		Allocation.Reset();
+		ViewData = nullptr;
+		ViewSize = 0;
+	}
+
+private:
+	/** Owner of the memory, freeing it when the last reference is released */
+	struct FAllocation : FNoncopyable
+	{
+		FAllocation(uint8* InData, int64 InSize)
+			: Data(InData)
+		  , Size(InSize)
+		{
+			INC_MEMORY_STAT_BY(STAT_RuntimeAudioImporter_LivePCMData, Size);
+		}
+
+		~FAllocation()
+		{
+			DEC_MEMORY_STAT_BY(STAT_RuntimeAudioImporter_LivePCMData, Size);
+			FMemory::Free(Data);
+		}
+
+		uint8* Data;
+		int64 Size;
+	};
+
+	/** Shared owner of the memory */
+	TSharedPtr<FAllocation, ESPMode::ThreadSafe> Allocation;
+
+	/** Start of the viewed memory */
+	uint8* ViewData;
+
+	/** Size of the viewed memory, in bytes */
+	int64 ViewSize;
+};
+
 /** PCM Data buffer structure */
 USTRUCT()
 struct FPCMStruct
 {
 	GENERATED_BODY()
 	
-	/** 32-bit float PCM data */
-	FBulkDataBuffer<uint8> PCMData;
+	/** 32-bit float PCM data, shared between copies of the structure. Frames inside the silent spans are not stored */
+	FSharedPCMBuffer PCMData;
 
-	/** Number of PCM frames */
+	/** Number of PCM frames, including the frames of the silent spans */
 	uint32 PCMNumOfFrames;
 
+	/** Silent spans sorted by the start frame. Empty unless silence trimming was requested in the import settings */
+	TArray<FPCMSilentSpan> SilentSpans;
+
 	/** Base constructor */
 	FPCMStruct()
 		: PCMNumOfFrames(0)
@@ -103,8 +339,232 @@ struct FPCMStruct
 	 */
 	FString ToString() const
 	{
-		return FString::Printf(TEXT("Validity of PCM data in memory: %s, number of PCM frames: %d, PCM data size: %d"),
-		                       PCMData.GetView().IsValidIndex(0) ? TEXT("Valid") : TEXT("Invalid"), PCMNumOfFrames, PCMData.GetView().Num());
+		return FString::Printf(TEXT("Validity of PCM data in memory: %s, number of PCM frames: %d, PCM data size: %d, number of silent spans: %d"),
+		                       PCMData.GetView().IsValidIndex(0) ? TEXT("Valid") : TEXT("Invalid"), PCMNumOfFrames, PCMData.GetView().Num(), SilentSpans.Num());
+	}
+};
+
+/** Precomputed magnitude spectrogram of the audio data. CPP use only. */
+struct FSpectrogramStruct
+{
+	/** Number of samples per FFT frame */
+	uint32 FFTSize;
+
+	/** Number of samples between the starts of consecutive FFT frames */
+	uint32 HopSize;
+
+	/** Number of frequency bins per FFT frame (FFTSize / 2 + 1) */
+	uint32 NumOfBins;
+
+	/** Number of FFT frames */
+	uint32 NumOfFrames;
+
+	/** Sample rate of the analyzed audio data */
+	uint32 SampleRate;
+
+	/** Linear magnitudes of all FFT frames, NumOfBins values per frame */
+	TArray<float> Magnitudes;
+
+	/** Base constructor */
+	FSpectrogramStruct()
+		: FFTSize(0)
+	  , HopSize(0)
+	  , NumOfBins(0)
+	  , NumOfFrames(0)
+	  , SampleRate(0)
+	{
+	}
+
+	/**
+	 * Get the index of the FFT frame centered closest to the specified time
+	 *
+	 * @param Time Time in seconds
+	 * @return Index of the FFT frame, or INDEX_NONE if the spectrogram is empty
+	 */
+	int32 GetFrameIndex(float Time) const
+	{
+		if (NumOfFrames == 0 || HopSize == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const float FramePosition = (Time * SampleRate - FFTSize / 2.f) / HopSize;
+		return FMath::Clamp(FMath::RoundToInt(FramePosition), 0, static_cast<int32>(NumOfFrames) - 1);
+	}
+
+	/**
+	 * Get the magnitudes of the FFT frame centered closest to the specified time
+	 *
+	 * @param Time Time in seconds
+	 * @return Magnitudes of the frame, empty if the spectrogram is empty
+	 */
+	TArrayView<const float> GetFrameAtTime(float Time) const
+	{
+		const int32 FrameIndex = GetFrameIndex(Time);
+		return FrameIndex == INDEX_NONE ? TArrayView<const float>() : TArrayView<const float>(Magnitudes.GetData() + FrameIndex * NumOfBins, NumOfBins);
+	}
+
+	/**
+	 * Converts Spectrogram Struct to a readable format
+	 *
+	 * @return String representation of the Spectrogram Struct
+	 */
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("FFT size: %d, hop size: %d, number of bins: %d, number of frames: %d"), FFTSize, HopSize, NumOfBins, NumOfFrames);
+	}
+};
+
+/** Minimum, maximum and RMS values of a range of audio frames of a single channel */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FWaveformPeak
+{
+	GENERATED_BODY()
+
+	/** Minimum sample value */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float Min;
+
+	/** Maximum sample value */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float Max;
+
+	/** Root mean square of the sample values */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float RMS;
+
+	/** Base constructor */
+	FWaveformPeak()
+		: Min(0.f)
+	  , Max(0.f)
+	  , RMS(0.f)
+	{
+	}
+};
+
+/** Multi-resolution waveform peaks of the audio data. CPP use only. */
+struct FWaveformPeaksStruct
+{
+	/** Number of frames covered by a single peak of the finest level */
+	uint32 BaseFramesPerPeak;
+
+	/** Number of channels */
+	uint32 NumOfChannels;
+
+	/** Number of audio frames the peaks were computed from */
+	int64 NumOfFrames;
+
+	/** Peak levels, from the finest to the coarsest. Each level covers twice as many frames per peak as the previous one and stores the peaks of all channels one after another */
+	TArray<TArray<FWaveformPeak>> Levels;
+
+	/** Base constructor */
+	FWaveformPeaksStruct()
+		: BaseFramesPerPeak(0)
+	  , NumOfChannels(0)
+	  , NumOfFrames(0)
+	{
+	}
+
+	/**
+	 * Get the number of frames covered by a single peak of the specified level
+	 */
+	int64 GetFramesPerPeak(int32 LevelIndex) const
+	{
+		return static_cast<int64>(BaseFramesPerPeak) << LevelIndex;
+	}
+
+	/**
+	 * Get the number of peaks per channel of the specified level
+	 */
+	int32 GetNumOfPeaks(int32 LevelIndex) const
+	{
+		const int64 FramesPerPeak = GetFramesPerPeak(LevelIndex);
+		return static_cast<int32>((NumOfFrames + FramesPerPeak - 1) / FramesPerPeak);
+	}
+
+	/**
+	 * Get the peaks of a single channel of the specified level
+	 *
+	 * @param LevelIndex Index of the level
+	 * @param ChannelIndex Index of the channel
+	 * @return Peaks of the channel, empty if the indices are invalid
+	 */
+	TArrayView<const FWaveformPeak> GetChannelPeaks(int32 LevelIndex, int32 ChannelIndex) const
+	{
+		if (!Levels.IsValidIndex(LevelIndex) || ChannelIndex < 0 || static_cast<uint32>(ChannelIndex) >= NumOfChannels)
+		{
+			return TArrayView<const FWaveformPeak>();
+		}
+
+		const int32 NumOfPeaks = GetNumOfPeaks(LevelIndex);
+		return TArrayView<const FWaveformPeak>(Levels[LevelIndex].GetData() + ChannelIndex * NumOfPeaks, NumOfPeaks);
+	}
+
+	/**
+	 * Converts Waveform Peaks Struct to a readable format
+	 *
+	 * @return String representation of the Waveform Peaks Struct
+	 */
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Base frames per peak: %d, number of channels: %d, number of frames: %lld, number of levels: %d"), BaseFramesPerPeak, NumOfChannels, NumOfFrames, Levels.Num());
+	}
+};
+
+/** Loudness of the audio data measured according to ITU-R BS.1770 / EBU R128 */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FLoudnessInfo
+{
+	GENERATED_BODY()
+
+	/** Gated integrated loudness, in LUFS */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float IntegratedLoudness;
+
+	/** Maximum absolute value of the 4x oversampled signal, in dBTP */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float TruePeak;
+
+	/** Linear gain that brings the audio data to the target loudness without exceeding the maximum true peak */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float NormalizationGain;
+
+	/** Base constructor */
+	FLoudnessInfo()
+		: IntegratedLoudness(0.f)
+	  , TruePeak(0.f)
+	  , NormalizationGain(1.f)
+	{
+	}
+
+	/**
+	 * Converts Loudness Info to a readable format
+	 *
+	 * @return String representation of the Loudness Info
+	 */
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Integrated loudness: %f LUFS, true peak: %f dBTP, normalization gain: %f"), IntegratedLoudness, TruePeak, NormalizationGain);
+	}
+};
+
+/** Loop region of the audio data. CPP use only. */
+struct FLoopRegionStruct
+{
+	/** First frame of the loop */
+	uint32 StartFrame;
+
+	/** Frame after the last frame of the loop */
+	uint32 EndFrame;
+
+	/**
+	 * Converts Loop Region Struct to a readable format
+	 *
+	 * @return String representation of the Loop Region Struct
+	 */
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Loop start frame: %d, loop end frame: %d"), StartFrame, EndFrame);
 	}
 };
 
@@ -117,6 +577,21 @@ struct FDecodedAudioStruct
 	/** PCM Data buffer */
 	FPCMStruct PCMInfo;
 
+	/** Precomputed spectrogram. Only valid if requested in the import settings */
+	TSharedPtr<const FSpectrogramStruct, ESPMode::ThreadSafe> SpectrogramInfo;
+
+	/** Precomputed waveform peaks. Only valid if requested in the import settings */
+	TSharedPtr<const FWaveformPeaksStruct, ESPMode::ThreadSafe> WaveformPeaksInfo;
+
+	/** Measured loudness. Only set if requested in the import settings */
+	TOptional<FLoudnessInfo> LoudnessInfo;
+
+	/** Gain to apply while generating the PCM data for playback */
+	float PlaybackGain = 1.f;
+
+	/** Loop region embedded in the audio data (e.g. the WAV "smpl" chunk). Only set if present and requested in the import settings */
+	TOptional<FLoopRegionStruct> LoopRegion;
+
 	/**
 	 * Converts Decoded Audio Struct to a readable format
 	 *
@@ -191,4 +666,222 @@ struct FCompressedSoundWaveInfo
 	  , Pitch(1.f)
 	{
 	}
-};
\ No newline at end of file
+};
+
+/** Settings applied to the decoded audio data before creating the imported sound wave */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FAudioImportSettings
+{
+	GENERATED_BODY()
+
+	/** Sample rate to convert the audio data to during import. 0 keeps the original sample rate */
+	UPROPERTY(BlueprintReadWrite, meta = (ClampMin = "0", ClampMax = "384000"), Category = "Runtime Audio Importer|Resampling")
+	int32 TargetSampleRate;
+
+	/** Quality of the resampling filter. Only used if the target sample rate differs from the original one */
+	UPROPERTY(BlueprintReadWrite, Category = "Runtime Audio Importer|Resampling")
+	EAudioResamplingQuality ResamplingQuality;
+
+	/** How to convert the channels of the audio data. Reducing the number of channels reduces memory usage and mixing cost */
+	UPROPERTY(BlueprintReadWrite, Category = "Runtime Audio Importer|Channels")
+	EChannelRemixMode ChannelRemixMode;
+
+	/** Index of the channel to keep. Only used with the "Extract single channel" remix mode */
+	UPROPERTY(BlueprintReadWrite, meta = (ClampMin = "0"), Category = "Runtime Audio Importer|Channels")
+	int32 ExtractedChannelIndex;
+
+	/** Whether to precompute a spectrogram of the audio data, which can then be queried by playback time without any DSP work */
+	UPROPERTY(BlueprintReadWrite, Category = "Runtime Audio Importer|Analysis")
+	bool bGenerateSpectrogram;
+
+	/** Number of samples per FFT frame of the spectrogram. Must be a power of two */
+	UPROPERTY(BlueprintReadWrite, meta = (ClampMin = "64", ClampMax = "16384", EditCondition = "bGenerateSpectrogram"), Category = "Runtime Audio Importer|Analysis")
+	int32 SpectrogramFFTSize;
+
+	/** Number of samples between the starts of consecutive FFT frames of the spectrogram */
+	UPROPERTY(BlueprintReadWrite, meta = (ClampMin = "1", EditCondition = "bGenerateSpectrogram"), Category = "Runtime Audio Importer|Analysis")
+	int32 SpectrogramHopSize;
+
+	/** Whether to precompute multi-resolution waveform peaks, which allow drawing the waveform at any zoom level without scanning the audio data */
+	UPROPERTY(BlueprintReadWrite, Category = "Runtime Audio Importer|Analysis")
+	bool bGenerateWaveformPeaks;
+
+	/** Whether to measure the loudness and the true peak of the audio data */
+	UPROPERTY(BlueprintReadWrite, Category = "Runtime Audio Importer|Loudness")
+	bool bAnalyzeLoudness;
+
+	/** How to apply the loudness normalization gain */
+	UPROPERTY(BlueprintReadWrite, meta = (EditCondition = "bAnalyzeLoudness"), Category = "Runtime Audio Importer|Loudness")
+	ELoudnessNormalization LoudnessNormalization;
+
+	/** Loudness to normalize to, in LUFS. EBU R128 recommends -23 LUFS for broadcast, while games and streaming usually target -16 to -14 LUFS */
+	UPROPERTY(BlueprintReadWrite, meta = (ClampMin = "-70", ClampMax = "0", EditCondition = "bAnalyzeLoudness"), Category = "Runtime Audio Importer|Loudness")
+	float TargetLoudness;
+
+	/** Maximum true peak after normalization, in dBTP. The normalization gain is reduced if necessary */
+	UPROPERTY(BlueprintReadWrite, meta = (ClampMax = "0", EditCondition = "bAnalyzeLoudness"), Category = "Runtime Audio Importer|Loudness")
+	float MaxTruePeak;
+
+	/** Whether to remove the leading and trailing silence and to store long internal silence without any memory */
+	UPROPERTY(BlueprintReadWrite, Category = "Runtime Audio Importer|Silence")
+	bool bTrimSilence;
+
+	/** Level below which the audio is considered silent, in dBFS */
+	UPROPERTY(BlueprintReadWrite, meta = (ClampMin = "-120", ClampMax = "0", EditCondition = "bTrimSilence"), Category = "Runtime Audio Importer|Silence")
+	float SilenceThreshold;
+
+	/** Minimum duration of internal silence to be stored without memory, in seconds */
+	UPROPERTY(BlueprintReadWrite, meta = (ClampMin = "0.01", EditCondition = "bTrimSilence"), Category = "Runtime Audio Importer|Silence")
+	float MinSilenceDuration;
+
+	/** Whether to loop the region embedded in the audio data during playback (e.g. the loop points of the WAV "smpl" chunk). A looping sound wave never finishes playing, so OnAudioPlaybackFinished is not broadcast */
+	UPROPERTY(BlueprintReadWrite, Category = "Runtime Audio Importer|Looping")
+	bool bUseEmbeddedLoopRegion;
+
+	FAudioImportSettings()
+		: TargetSampleRate(0)
+	  , ResamplingQuality(EAudioResamplingQuality::Medium)
+	  , ChannelRemixMode(EChannelRemixMode::None)
+	  , ExtractedChannelIndex(0)
+	  , bGenerateSpectrogram(false)
+	  , SpectrogramFFTSize(1024)
+	  , SpectrogramHopSize(512)
+	  , bGenerateWaveformPeaks(false)
+	  , bAnalyzeLoudness(false)
+	  , LoudnessNormalization(ELoudnessNormalization::ApplyOnPlayback)
+	  , TargetLoudness(-23.f)
+	  , MaxTruePeak(-1.f)
+	  , bTrimSilence(false)
+	  , SilenceThreshold(-60.f)
+	  , MinSilenceDuration(0.25f)
+	  , bUseEmbeddedLoopRegion(false)
+	{
+	}
+};
+
+/** Encoded audio data retained to re-decode the PCM data of an imported sound wave after it has been evicted. CPP use only. */
+struct FEncodedAudioSourceStruct
+{
+	/** Encoded audio data the sound wave was imported from */
+	TArray<uint8> AudioData;
+
+	/** Format of the encoded audio data */
+	EAudioFormat AudioFormat;
+
+	/** Settings the audio data was imported with */
+	FAudioImportSettings ImportSettings;
+
+	/** Base constructor */
+	FEncodedAudioSourceStruct(TArray<uint8> AudioData, EAudioFormat AudioFormat, const FAudioImportSettings& ImportSettings)
+		: AudioData(MoveTemp(AudioData))
+	  , AudioFormat(AudioFormat)
+	  , ImportSettings(ImportSettings)
+	{
+	}
+};
+
+/** Timings and sizes of a single import, e.g. to track the import performance by format and size */
+USTRUCT(BlueprintType, Category = "Runtime Audio Importer")
+struct FImportTimingReport
+{
+	GENERATED_BODY()
+
+	/** Format of the imported audio data */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	EAudioFormat AudioFormat;
+
+	/** Time spent reading the audio file or streaming the audio data of the pre-imported sound asset, in seconds. Zero unless imported from either */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float ReadTime;
+
+	/** Time spent probing the decoders to determine the audio format, in seconds. Zero unless the format was determined automatically and not recognized by its signature */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float ProbeTime;
+
+	/** Time spent decoding the audio data (or transcoding the RAW data) to 32-bit float PCM, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float DecodeTime;
+
+	/** Time spent processing the decoded audio data according to the import settings, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float ProcessTime;
+
+	/** Time spent creating and filling in the sound wave on the game thread, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float FinalizeTime;
+
+	/** Time from the start of the import to the result, in seconds. Includes the time spent waiting for threads */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float TotalTime;
+
+	/** Size of the imported audio data, in bytes */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 InputSize;
+
+	/** Size of the PCM data of the imported sound wave, in bytes */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 OutputSize;
+
+	/** Largest total size of the audio buffers held by the import at the same time, in bytes. Estimated from the sizes of the buffers at the end of each stage */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	int64 PeakAllocationSize;
+
+	/** Duration of the imported audio data, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float Duration;
+
+	/** Seconds of audio decoded and processed per second of wall time. Zero if the decoding and processing time is unknown */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime Audio Importer")
+	float Throughput;
+
+	/** Time the import started, in seconds. CPP use only */
+	double StartTime;
+
+	/** Base constructor. Starts the timing of the import */
+	FImportTimingReport()
+		: AudioFormat(EAudioFormat::Invalid)
+	  , ReadTime(0.f)
+	  , ProbeTime(0.f)
+	  , DecodeTime(0.f)
+	  , ProcessTime(0.f)
+	  , FinalizeTime(0.f)
+	  , TotalTime(0.f)
+	  , InputSize(0)
+	  , OutputSize(0)
+	  , PeakAllocationSize(0)
+	  , Duration(0.f)
+	  , Throughput(0.f)
+	  , StartTime(FPlatformTime::Seconds())
+	{
+	}
+
+	/**
+	 * Raise the peak allocation size to the specified size if it is larger
+	 *
+	 * @param AllocationSize Total size of the audio buffers held at the moment, in bytes
+	 */
+	void UpdatePeakAllocationSize(int64 AllocationSize)
+	{
+		PeakAllocationSize = FMath::Max(PeakAllocationSize, AllocationSize);
+	}
+
+	/**
+	 * Compute the throughput from the duration and the time spent decoding and processing the audio data
+	 */
+	void UpdateThroughput()
+	{
+		const float DecodeAndProcessTime = DecodeTime + ProcessTime;
+		Throughput = DecodeAndProcessTime > 0.f ? Duration / DecodeAndProcessTime : 0.f;
+	}
+
+	/**
+	 * Converts Import Timing Report to a readable format
+	 *
+	 * @return String representation of the Import Timing Report
+	 */
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Audio format: %s, read time: %f, probe time: %f, decode time: %f, process time: %f, finalize time: %f, total time: %f, input size: %lld, output size: %lld, peak allocation size: %lld, duration: %f, throughput: %fx"),
+		                       *UEnum::GetValueAsName(AudioFormat).ToString(), ReadTime, ProbeTime, DecodeTime, ProcessTime, FinalizeTime, TotalTime, InputSize, OutputSize, PeakAllocationSize, Duration, Throughput);
+	}
+};
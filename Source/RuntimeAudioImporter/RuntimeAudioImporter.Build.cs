@@ -29,12 +29,9 @@ public class RuntimeAudioImporter : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
-				"Core"
+				"Core",
+				"AudioPlatformConfiguration"
 			}
 		);
-
-#if !UE_5_00_OR_LATER
-		PrivateDependencyModuleNames.Add("AudioPlatformConfiguration");
-#endif
 	}
 }
\ No newline at end of file
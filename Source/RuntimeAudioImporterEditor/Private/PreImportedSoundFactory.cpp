@@ -3,9 +3,18 @@
 #include "PreImportedSoundFactory.h"
 #include "PreImportedSoundAsset.h"
 #include "Misc/FileHelper.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
 
 DEFINE_LOG_CATEGORY(LogPreImportedSoundFactory);
 
+/** Number of waveform peaks per channel stored for the asset thumbnail */
+static constexpr int32 NumOfThumbnailPeaksPerChannel = 256;
+
+TQueue<UPreImportedSoundFactory::FPendingThumbnailPeaks, EQueueMode::Mpsc> UPreImportedSoundFactory::PendingThumbnailPeaksQueue;
+TAtomic<int32> UPreImportedSoundFactory::NumOfThumbnailPeaksTasks{0};
+bool UPreImportedSoundFactory::bThumbnailPeaksTickerRegistered = false;
+
 #include "RuntimeAudioImporterLibrary.h"
 
 UPreImportedSoundFactory::UPreImportedSoundFactory()
@@ -26,39 +35,112 @@ bool UPreImportedSoundFactory::FactoryCanImport(const FString& Filename)
 
 UObject* UPreImportedSoundFactory::FactoryCreateFile(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags, const FString& Filename, const TCHAR* Params, FFeedbackContext* Warn, bool& bOutOperationCanceled)
 {
-	UPreImportedSoundAsset* PreImportedSoundAsset;
-
 	TArray<uint8> AudioDataArray;
 
-	if (FFileHelper::LoadFileToArray(AudioDataArray, *Filename))
+	if (!FFileHelper::LoadFileToArray(AudioDataArray, *Filename))
 	{
-		FDecodedAudioStruct DecodedAudioInfo;
+		UE_LOG(LogPreImportedSoundFactory, Error, TEXT("Unable to read the audio file '%s'. Check file permissions"), *Filename);
+		return nullptr;
+	}
+
+	// Only the headers are parsed here, the audio data is decoded for the thumbnail on a worker thread
+	EAudioFormat AudioFormat{EAudioFormat::Auto};
+	FSoundWaveBasicStruct BasicInfo;
+
+	if (!URuntimeAudioImporterLibrary::GetAudioInfo(AudioDataArray.GetData(), AudioDataArray.Num(), AudioFormat, BasicInfo))
+	{
+		UE_LOG(LogPreImportedSoundFactory, Error, TEXT("Unable to read the audio information of the audio file '%s'"), *Filename);
+		return nullptr;
+	}
 
-		uint8* EncodedAudioDataPtr = static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(AudioDataArray.Num() - 2), AudioDataArray.GetData(), AudioDataArray.Num() - 2));
-		FEncodedAudioStruct EncodedAudioInfo = FEncodedAudioStruct(EncodedAudioDataPtr, AudioDataArray.Num() - 2, EAudioFormat::Auto);
+	UPreImportedSoundAsset* PreImportedSoundAsset = NewObject<UPreImportedSoundAsset>(InParent, UPreImportedSoundAsset::StaticClass(), InName, Flags);
+	PreImportedSoundAsset->SetAudioData(AudioDataArray);
+	PreImportedSoundAsset->AudioFormat = AudioFormat;
+	PreImportedSoundAsset->SourceFilePath = Filename;
 
-		if (!URuntimeAudioImporterLibrary::DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo))
+	PreImportedSoundAsset->SoundDuration = URuntimeAudioImporterLibrary::ConvertSecondsToString(BasicInfo.Duration);
+	PreImportedSoundAsset->NumberOfChannels = BasicInfo.NumOfChannels;
+	PreImportedSoundAsset->SampleRate = BasicInfo.SampleRate;
+
+	GenerateThumbnailPeaksAsync(PreImportedSoundAsset, Filename, AudioFormat);
+
+	bOutOperationCanceled = false;
+
+	return PreImportedSoundAsset;
+}
+
+void UPreImportedSoundFactory::GenerateThumbnailPeaksAsync(UPreImportedSoundAsset* PreImportedSoundAsset, const FString& Filename, EAudioFormat AudioFormat)
+{
+	check(IsInGameThread());
+
+	++NumOfThumbnailPeaksTasks;
+
+	// The file is read again on the worker thread, so that the queued tasks of a large batch import do not hold the audio data of every file
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakPreImportedSoundAsset = MakeWeakObjectPtr(PreImportedSoundAsset), Filename, AudioFormat]()
+	{
+		FPendingThumbnailPeaks PendingThumbnailPeaks;
+		PendingThumbnailPeaks.PreImportedSoundAsset = WeakPreImportedSoundAsset;
+
+		TArray<uint8> AudioDataArray;
+		if (FFileHelper::LoadFileToArray(AudioDataArray, *Filename))
+		{
+			const int32 AudioDataSize = AudioDataArray.Num();
+			uint8* EncodedAudioDataPtr = static_cast<uint8*>(FMemory::Memcpy(FMemory::Malloc(AudioDataSize), AudioDataArray.GetData(), AudioDataSize));
+			AudioDataArray.Empty();
+
+			FEncodedAudioStruct EncodedAudioInfo(EncodedAudioDataPtr, AudioDataSize, AudioFormat);
+			FDecodedAudioStruct DecodedAudioInfo;
+
+			if (!URuntimeAudioImporterLibrary::DecodeAudioData(EncodedAudioInfo, DecodedAudioInfo) || !URuntimeAudioImporterLibrary::GenerateWaveformThumbnailPeaks(DecodedAudioInfo, NumOfThumbnailPeaksPerChannel, PendingThumbnailPeaks.ThumbnailPeaks))
+			{
+				UE_LOG(LogPreImportedSoundFactory, Warning, TEXT("Unable to generate the waveform thumbnail of the audio file '%s'"), *Filename);
+			}
+		}
+		else
 		{
-			UE_LOG(LogPreImportedSoundFactory, Error, TEXT("Unable to decode the audio file '%s'"), *Filename);
-			return nullptr;
+			UE_LOG(LogPreImportedSoundFactory, Warning, TEXT("Unable to read the audio file '%s' to generate the waveform thumbnail"), *Filename);
 		}
 
-		PreImportedSoundAsset = NewObject<UPreImportedSoundAsset>(InParent, UPreImportedSoundAsset::StaticClass(), InName, Flags);
-		PreImportedSoundAsset->AudioDataArray = AudioDataArray;
-		PreImportedSoundAsset->AudioFormat = EncodedAudioInfo.AudioFormat;
-		PreImportedSoundAsset->SourceFilePath = Filename;
+		PendingThumbnailPeaksQueue.Enqueue(MoveTemp(PendingThumbnailPeaks));
+		--NumOfThumbnailPeaksTasks;
+	});
 
-		PreImportedSoundAsset->SoundDuration = URuntimeAudioImporterLibrary::ConvertSecondsToString(DecodedAudioInfo.SoundWaveBasicInfo.Duration);
-		PreImportedSoundAsset->NumberOfChannels = DecodedAudioInfo.SoundWaveBasicInfo.NumOfChannels;
-		PreImportedSoundAsset->SampleRate = DecodedAudioInfo.SoundWaveBasicInfo.SampleRate;
-	}
-	else
+	// The generated peaks of all files are assigned to their assets in one pass per tick, instead of a game thread task per file
+	if (!bThumbnailPeaksTickerRegistered)
 	{
-		UE_LOG(LogPreImportedSoundFactory, Error, TEXT("Unable to read the audio file '%s'. Check file permissions"), *Filename);
-		return nullptr;
+		bThumbnailPeaksTickerRegistered = true;
+
+		const FTickerDelegate TickerDelegate = FTickerDelegate::CreateStatic(&UPreImportedSoundFactory::AssignPendingThumbnailPeaks);
+
+#if ENGINE_MAJOR_VERSION < 5
+		FTicker::GetCoreTicker().AddTicker(TickerDelegate);
+#else
+		FTSTicker::GetCoreTicker().AddTicker(TickerDelegate);
+#endif
 	}
+}
 
-	bOutOperationCanceled = false;
+bool UPreImportedSoundFactory::AssignPendingThumbnailPeaks(float DeltaTime)
+{
+	// Read before draining the queue, so that the peaks of a task finishing meanwhile are not left behind
+	const bool bTasksRemaining{NumOfThumbnailPeaksTasks > 0};
 
-	return PreImportedSoundAsset;
+	FPendingThumbnailPeaks PendingThumbnailPeaks;
+	while (PendingThumbnailPeaksQueue.Dequeue(PendingThumbnailPeaks))
+	{
+		UPreImportedSoundAsset* PreImportedSoundAsset = PendingThumbnailPeaks.PreImportedSoundAsset.Get();
+		if (PreImportedSoundAsset == nullptr || PendingThumbnailPeaks.ThumbnailPeaks.Num() == 0)
+		{
+			continue;
+		}
+
+		PreImportedSoundAsset->ThumbnailPeaks = MoveTemp(PendingThumbnailPeaks.ThumbnailPeaks);
+
+		// Refreshing the thumbnail
+		PreImportedSoundAsset->MarkPackageDirty();
+		PreImportedSoundAsset->PostEditChange();
+	}
+
+	bThumbnailPeaksTickerRegistered = bTasksRemaining;
+	return bTasksRemaining;
 }
@@ -0,0 +1,51 @@
+// Georgy Treshchev 2022.
+
+#include "PreImportedSoundThumbnailRenderer.h"
+#include "PreImportedSoundAsset.h"
+#include "CanvasTypes.h"
+
+bool UPreImportedSoundThumbnailRenderer::CanVisualizeAsset(UObject* Object)
+{
+	const UPreImportedSoundAsset* PreImportedSoundAsset = Cast<UPreImportedSoundAsset>(Object);
+	return PreImportedSoundAsset != nullptr && PreImportedSoundAsset->NumberOfChannels > 0 && PreImportedSoundAsset->ThumbnailPeaks.Num() >= PreImportedSoundAsset->NumberOfChannels;
+}
+
+void UPreImportedSoundThumbnailRenderer::Draw(UObject* Object, int32 X, int32 Y, uint32 Width, uint32 Height, FRenderTarget* RenderTarget, FCanvas* Canvas, bool bAdditionalViewFamily)
+{
+	const UPreImportedSoundAsset* PreImportedSoundAsset = Cast<UPreImportedSoundAsset>(Object);
+
+	if (PreImportedSoundAsset == nullptr || !CanVisualizeAsset(Object) || Width == 0 || Height == 0)
+	{
+		return;
+	}
+
+	const FLinearColor BackgroundColor{0.02f, 0.02f, 0.02f};
+	const FLinearColor PeakColor{0.1f, 0.55f, 0.8f};
+	const FLinearColor RMSColor{0.45f, 0.8f, 1.f};
+
+	Canvas->DrawTile(X, Y, Width, Height, 0, 0, 1, 1, BackgroundColor);
+
+	// Each channel is drawn in its own horizontal lane
+	const int32 NumOfChannels = PreImportedSoundAsset->NumberOfChannels;
+	const int32 NumOfPeaksPerChannel = PreImportedSoundAsset->ThumbnailPeaks.Num() / NumOfChannels;
+	const float LaneHeight = static_cast<float>(Height) / NumOfChannels;
+
+	for (int32 ChannelIndex = 0; ChannelIndex < NumOfChannels; ++ChannelIndex)
+	{
+		const FWaveformPeak* ChannelPeaks = PreImportedSoundAsset->ThumbnailPeaks.GetData() + ChannelIndex * NumOfPeaksPerChannel;
+		const float LaneCenter = Y + LaneHeight * (ChannelIndex + 0.5f);
+		const float HalfLaneHeight = LaneHeight * 0.5f;
+
+		for (uint32 Column = 0; Column < Width; ++Column)
+		{
+			const FWaveformPeak& Peak = ChannelPeaks[FMath::Min<int32>(static_cast<int32>(static_cast<uint64>(Column) * NumOfPeaksPerChannel / Width), NumOfPeaksPerChannel - 1)];
+
+			const float PeakTop = LaneCenter - FMath::Clamp(Peak.Max, -1.f, 1.f) * HalfLaneHeight;
+			const float PeakBottom = LaneCenter - FMath::Clamp(Peak.Min, -1.f, 1.f) * HalfLaneHeight;
+			Canvas->DrawTile(X + Column, PeakTop, 1, FMath::Max(PeakBottom - PeakTop, 1.f), 0, 0, 1, 1, PeakColor);
+
+			const float RMSHeight = FMath::Min(Peak.RMS, 1.f) * HalfLaneHeight;
+			Canvas->DrawTile(X + Column, LaneCenter - RMSHeight, 1, FMath::Max(RMSHeight * 2, 1.f), 0, 0, 1, 1, RMSColor);
+		}
+	}
+}
@@ -1,15 +1,23 @@
 // Georgy Treshchev 2022.
 
 #include "RuntimeAudioImporterEditor.h"
+#include "PreImportedSoundAsset.h"
+#include "PreImportedSoundThumbnailRenderer.h"
+#include "ThumbnailRendering/ThumbnailManager.h"
 
 #define LOCTEXT_NAMESPACE "FRuntimeAudioImporterEditorModule"
 
 void FRuntimeAudioImporterEditorModule::StartupModule()
 {
+	UThumbnailManager::Get().RegisterCustomRenderer(UPreImportedSoundAsset::StaticClass(), UPreImportedSoundThumbnailRenderer::StaticClass());
 }
 
 void FRuntimeAudioImporterEditorModule::ShutdownModule()
 {
+	if (UObjectInitialized())
+	{
+		UThumbnailManager::Get().UnregisterCustomRenderer(UPreImportedSoundAsset::StaticClass());
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -8,6 +8,10 @@
 #include "Logging/LogMacros.h"
 #include "Logging/LogVerbosity.h"
 
+#include "Containers/Queue.h"
+#include "Templates/Atomic.h"
+#include "RuntimeAudioImporterTypes.h"
+
 #include "Factories/Factory.h"
 #include "PreImportedSoundFactory.generated.h"
 
@@ -30,4 +34,35 @@ public:
 	virtual bool FactoryCanImport(const FString& Filename) override;
 	virtual UObject* FactoryCreateFile(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags, const FString& Filename, const TCHAR* Params, FFeedbackContext* Warn, bool& bOutOperationCanceled) override;
 	//~ end UFactory Interface.
+
+private:
+	/** Thumbnail peaks generated on a worker thread, waiting to be assigned to their asset */
+	struct FPendingThumbnailPeaks
+	{
+		TWeakObjectPtr<class UPreImportedSoundAsset> PreImportedSoundAsset;
+		TArray<FWaveformPeak> ThumbnailPeaks;
+	};
+
+	/**
+	 * Generate the thumbnail peaks of the imported asset on a worker thread. The peaks are assigned to the asset on the game thread once generated
+	 *
+	 * @param PreImportedSoundAsset The imported asset
+	 * @param Filename Path to the imported audio file
+	 * @param AudioFormat Format of the imported audio file
+	 */
+	static void GenerateThumbnailPeaksAsync(class UPreImportedSoundAsset* PreImportedSoundAsset, const FString& Filename, EAudioFormat AudioFormat);
+
+	/**
+	 * Assign the generated thumbnail peaks of all imported assets in a single pass. Ticks on the game thread while thumbnail peaks are being generated
+	 */
+	static bool AssignPendingThumbnailPeaks(float DeltaTime);
+
+	/** Generated thumbnail peaks waiting to be assigned */
+	static TQueue<FPendingThumbnailPeaks, EQueueMode::Mpsc> PendingThumbnailPeaksQueue;
+
+	/** Number of thumbnail peaks being generated */
+	static TAtomic<int32> NumOfThumbnailPeaksTasks;
+
+	/** Whether the ticker assigning the generated thumbnail peaks is registered. Accessed on the game thread only */
+	static bool bThumbnailPeaksTickerRegistered;
 };
@@ -0,0 +1,22 @@
+// Georgy Treshchev 2022.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ThumbnailRendering/DefaultSizedThumbnailRenderer.h"
+#include "PreImportedSoundThumbnailRenderer.generated.h"
+
+/**
+ * Draws the waveform overview stored in the pre-imported sound asset, so rendering the thumbnail never touches the audio data
+ */
+UCLASS()
+class RUNTIMEAUDIOIMPORTEREDITOR_API UPreImportedSoundThumbnailRenderer : public UDefaultSizedThumbnailRenderer
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UThumbnailRenderer Interface.
+	virtual bool CanVisualizeAsset(UObject* Object) override;
+	virtual void Draw(UObject* Object, int32 X, int32 Y, uint32 Width, uint32 Height, FRenderTarget* RenderTarget, FCanvas* Canvas, bool bAdditionalViewFamily) override;
+	//~ end UThumbnailRenderer Interface.
+};